@@ -10,9 +10,13 @@
 #ifndef BOOST_HTTP_PROTO_HPP
 #define BOOST_HTTP_PROTO_HPP
 
+#include <boost/http_proto/accept_encoding.hpp>
+#include <boost/http_proto/async_sink.hpp>
+#include <boost/http_proto/async_source.hpp>
 #include <boost/http_proto/buffered_base.hpp>
 #include <boost/http_proto/context.hpp>
 #include <boost/http_proto/deflate.hpp>
+#include <boost/http_proto/digest.hpp>
 #include <boost/http_proto/error.hpp>
 #include <boost/http_proto/field.hpp>
 #include <boost/http_proto/fields.hpp>
@@ -22,9 +26,13 @@
 #include <boost/http_proto/file.hpp>
 #include <boost/http_proto/file_base.hpp>
 #include <boost/http_proto/file_body.hpp>
+#include <boost/http_proto/file_mmap.hpp>
+#include <boost/http_proto/file_region.hpp>
 #include <boost/http_proto/file_posix.hpp>
 #include <boost/http_proto/file_win32.hpp>
 #include <boost/http_proto/file_stdio.hpp>
+#include <boost/http_proto/file_uring.hpp>
+#include <boost/http_proto/generator_source.hpp>
 #include <boost/http_proto/header_limits.hpp>
 #include <boost/http_proto/message_base.hpp>
 #include <boost/http_proto/message_view_base.hpp>
@@ -35,23 +43,32 @@
 #include <boost/http_proto/request_view.hpp>
 #include <boost/http_proto/response.hpp>
 #include <boost/http_proto/response_parser.hpp>
+#include <boost/http_proto/response_template.hpp>
 #include <boost/http_proto/response_view.hpp>
 #include <boost/http_proto/serializer.hpp>
+#include <boost/http_proto/shared_body.hpp>
 #include <boost/http_proto/sink.hpp>
 #include <boost/http_proto/source.hpp>
 #include <boost/http_proto/status.hpp>
 #include <boost/http_proto/string_body.hpp>
+#include <boost/http_proto/uring_body.hpp>
 #include <boost/http_proto/version.hpp>
+#include <boost/http_proto/view_source.hpp>
 
 #include <boost/http_proto/rfc/combine_field_values.hpp>
 #include <boost/http_proto/rfc/list_rule.hpp>
 #include <boost/http_proto/rfc/parameter.hpp>
 #include <boost/http_proto/rfc/quoted_token_rule.hpp>
 #include <boost/http_proto/rfc/quoted_token_view.hpp>
+#include <boost/http_proto/rfc/range_rule.hpp>
 #include <boost/http_proto/rfc/token_rule.hpp>
 #include <boost/http_proto/rfc/upgrade_rule.hpp>
 
+#include <boost/http_proto/service/compression_cache.hpp>
+#include <boost/http_proto/service/date_service.hpp>
 #include <boost/http_proto/service/service.hpp>
+#include <boost/http_proto/service/uring_service.hpp>
+#include <boost/http_proto/service/worker_pool.hpp>
 #include <boost/http_proto/service/zlib_service.hpp>
 
 #endif
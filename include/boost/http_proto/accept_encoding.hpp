@@ -0,0 +1,109 @@
+//
+// Copyright (c) 2026 agent (agent@local)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/cppalliance/http_proto
+//
+
+#ifndef BOOST_HTTP_PROTO_ACCEPT_ENCODING_HPP
+#define BOOST_HTTP_PROTO_ACCEPT_ENCODING_HPP
+
+#include <boost/http_proto/detail/config.hpp>
+#include <boost/http_proto/metadata.hpp>
+#include <boost/core/detail/string_view.hpp>
+#include <initializer_list>
+
+namespace boost {
+namespace http_proto {
+
+#ifndef BOOST_HTTP_PROTO_DOCS
+class fields_view_base;
+#endif
+
+/** Select a content coding from an Accept-Encoding value
+
+    This function chooses the content coding to
+    apply to a response, from the codings listed
+    in `supported` and the qvalues expressed by
+    the client. The coding with the highest
+    qvalue is chosen; ties are broken by the
+    order of `supported`. Identity is chosen
+    when it has a higher qvalue than every
+    supported coding, or when no supported
+    coding is acceptable.
+
+    The exact values sent by common browsers are
+    recognized without parsing. Other values are
+    parsed, and a malformed value is treated as
+    accepting only identity. No memory is
+    allocated.
+
+    @par Example
+    @code
+    switch( negotiate_encoding(
+        req.value_or( field::accept_encoding, "" ) ) )
+    {
+    case encoding::gzip:
+        sr.use_gzip_encoding();
+        res.set( field::content_encoding, "gzip" );
+        break;
+    case encoding::deflate:
+        sr.use_deflate_encoding();
+        res.set( field::content_encoding, "deflate" );
+        break;
+    default:
+        break;
+    }
+    @endcode
+
+    @return The chosen coding, @ref encoding::identity
+    to send the body unencoded, or
+    @ref encoding::unsupported if no coding,
+    including identity, is acceptable.
+
+    @param value The Accept-Encoding field value.
+
+    @param supported The codings the caller is able
+    to apply, in order of preference.
+
+    @par Specification
+    @li <a href="https://www.rfc-editor.org/rfc/rfc9110#section-12.5.3"
+        >12.5.3.  Accept-Encoding (rfc9110)</a>
+*/
+BOOST_HTTP_PROTO_DECL
+encoding
+negotiate_encoding(
+    core::string_view value,
+    std::initializer_list<encoding> supported = {
+        encoding::gzip, encoding::deflate }) noexcept;
+
+/** Select a content coding from the Accept-Encoding fields
+
+    This function behaves as the overload taking
+    a field value, combining every Accept-Encoding
+    field in `fields`. When there are no such
+    fields, identity is chosen.
+
+    @return The chosen coding, @ref encoding::identity
+    to send the body unencoded, or
+    @ref encoding::unsupported if no coding,
+    including identity, is acceptable.
+
+    @param fields The fields of the request.
+
+    @param supported The codings the caller is able
+    to apply, in order of preference.
+*/
+BOOST_HTTP_PROTO_DECL
+encoding
+negotiate_encoding(
+    fields_view_base const& fields,
+    std::initializer_list<encoding> supported = {
+        encoding::gzip, encoding::deflate }) noexcept;
+
+} // http_proto
+} // boost
+
+#endif
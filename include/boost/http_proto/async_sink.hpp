@@ -0,0 +1,172 @@
+//
+// Copyright (c) 2026 agent (agent@local)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/cppalliance/http_proto
+//
+
+#ifndef BOOST_HTTP_PROTO_ASYNC_SINK_HPP
+#define BOOST_HTTP_PROTO_ASYNC_SINK_HPP
+
+#include <boost/http_proto/detail/config.hpp>
+#include <boost/http_proto/sink.hpp>
+#include <boost/buffers/const_buffer.hpp>
+#include <boost/system/error_code.hpp>
+#include <atomic>
+#include <cstddef>
+
+namespace boost {
+namespace http_proto {
+
+/** A sink which consumes data without blocking
+
+    The data given to an asynchronous sink is
+    passed to an operation which may finish
+    after the parser hands it over, such as a
+    write to a remote store.
+
+    The parser calls @ref on_start with body
+    data in its own buffer, which stays in place
+    until the derived class calls @ref complete,
+    either before returning or later on any
+    thread. Until then, the parser returns
+    @ref error::would_block. When the operation
+    completes later, the handler set with
+    @ref set_handler is invoked, and the caller
+    should call `parser::parse` again, which
+    consumes the data that was written.
+
+    The parser must not be reset or destroyed
+    while an operation is pending. Content
+    decoding in the parser is not supported
+    with this sink.
+
+    @par Thread Safety
+    Only @ref complete may be called
+    concurrently with other member functions.
+
+    @see
+        @ref async_source.
+*/
+class BOOST_HTTP_PROTO_DECL
+    async_sink
+    : public sink
+{
+public:
+    /** Receives notification that an operation completed
+    */
+    struct handler
+    {
+        /** Called when a pending operation completes
+
+            This is called on the thread which
+            called @ref complete, and should
+            arrange for the parser to be resumed,
+            for example by posting to the thread
+            which owns it.
+        */
+        virtual
+        void
+        on_resume() noexcept = 0;
+
+    protected:
+        ~handler() = default;
+    };
+
+    /** Constructor
+    */
+    async_sink() noexcept;
+
+    /** Set the handler invoked when an operation completes
+
+        @param h The handler, or `nullptr`
+        to not be notified.
+    */
+    void
+    set_handler(handler* h) noexcept
+    {
+        h_ = h;
+    }
+
+    /** Return true if an operation is in progress
+    */
+    bool
+    is_pending() const noexcept
+    {
+        return state_.load(
+            std::memory_order_acquire) == pending;
+    }
+
+#ifdef BOOST_HTTP_PROTO_DOCS
+protected:
+#else
+private:
+#endif
+    /** Derived class override.
+
+        This pure virtual function is called by
+        the implementation and must be overriden.
+        The callee should start consuming the
+        data in `b`, and call @ref complete once
+        it has.
+
+        @param b The data to consume. It remains
+        valid until the operation completes.
+
+        @param more `true` if there will be one
+            or more subsequent calls to @ref on_start.
+    */
+    virtual
+    void
+    on_start(
+        buffers::const_buffer b,
+        bool more) = 0;
+
+protected:
+    /** Complete the operation started by @ref on_start
+
+        This may be called from within @ref on_start,
+        or later from any thread. Fewer than
+        `b.size()` bytes may be consumed; the
+        rest is then passed to @ref on_start
+        in a new operation.
+
+        @param bytes The number of bytes
+        consumed from the buffer.
+
+        @param ec The error, if any occurred.
+    */
+    void
+    complete(
+        std::size_t bytes,
+        system::error_code ec = {}) noexcept;
+
+private:
+    enum : int
+    {
+        idle,
+        starting,
+        pending,
+        done
+    };
+
+    results
+    on_write(
+        buffers::const_buffer b,
+        bool more) override final;
+
+    bool start(buffers::const_buffer b, bool more);
+    results take() noexcept;
+
+    std::atomic<int> state_;
+    handler* h_ = nullptr;
+    std::size_t size_ = 0;
+    results rv_;
+};
+
+} // http_proto
+} // boost
+
+#endif
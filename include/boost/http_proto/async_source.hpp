@@ -0,0 +1,189 @@
+//
+// Copyright (c) 2026 agent (agent@local)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/cppalliance/http_proto
+//
+
+#ifndef BOOST_HTTP_PROTO_ASYNC_SOURCE_HPP
+#define BOOST_HTTP_PROTO_ASYNC_SOURCE_HPP
+
+#include <boost/http_proto/detail/config.hpp>
+#include <boost/http_proto/source.hpp>
+#include <boost/buffers/mutable_buffer.hpp>
+#include <boost/system/error_code.hpp>
+#include <atomic>
+#include <cstddef>
+
+namespace boost {
+namespace http_proto {
+
+/** A source which produces data without blocking
+
+    The data of an asynchronous source comes
+    from an operation which may finish after
+    the serializer asks for it, such as a query
+    on a database cursor or a request to a
+    remote store.
+
+    The serializer calls @ref on_start with a
+    buffer in its own storage. The derived class
+    writes the data there, and calls @ref complete
+    when it is done, either before returning or
+    later on any thread. Until then, the serializer
+    returns @ref error::would_block. When the
+    operation completes later, the handler set with
+    @ref set_handler is invoked, and the caller
+    should call `serializer::prepare` again, which
+    returns the data without copying it.
+
+    The serializer must not be reset or destroyed
+    while an operation is pending.
+
+    @par Example
+    @code
+    struct cursor_source : async_source
+    {
+        void
+        on_start(buffers::mutable_buffer b) override
+        {
+            db.async_fetch(b.data(), b.size(),
+                [this](std::size_t n, bool last)
+                {
+                    complete(n, last);
+                });
+        }
+    };
+
+    auto& src = sr.start< cursor_source >( res );
+    src.set_handler( &resumer );
+    @endcode
+
+    @par Thread Safety
+    Only @ref complete may be called
+    concurrently with other member functions.
+
+    @see
+        @ref async_sink.
+*/
+class BOOST_HTTP_PROTO_DECL
+    async_source
+    : public source
+{
+public:
+    /** Receives notification that an operation completed
+    */
+    struct handler
+    {
+        /** Called when a pending operation completes
+
+            This is called on the thread which
+            called @ref complete, and should
+            arrange for the serializer to be
+            resumed, for example by posting to
+            the thread which owns it.
+        */
+        virtual
+        void
+        on_resume() noexcept = 0;
+
+    protected:
+        ~handler() = default;
+    };
+
+    /** Constructor
+    */
+    async_source() noexcept;
+
+    /** Set the handler invoked when an operation completes
+
+        @param h The handler, or `nullptr`
+        to not be notified.
+    */
+    void
+    set_handler(handler* h) noexcept
+    {
+        h_ = h;
+    }
+
+    /** Return true if an operation is in progress
+    */
+    bool
+    is_pending() const noexcept
+    {
+        return state_.load(
+            std::memory_order_acquire) == pending;
+    }
+
+#ifdef BOOST_HTTP_PROTO_DOCS
+protected:
+#else
+private:
+#endif
+    /** Derived class override.
+
+        This pure virtual function is called by
+        the implementation and must be overriden.
+        The callee should start producing up to
+        `b.size()` bytes of data into `b`, and
+        call @ref complete once it has.
+
+        @param b The buffer to use. It remains
+        valid until the data is returned to the
+        serializer.
+    */
+    virtual
+    void
+    on_start(
+        buffers::mutable_buffer b) = 0;
+
+protected:
+    /** Complete the operation started by @ref on_start
+
+        This may be called from within @ref on_start,
+        or later from any thread. Fewer than
+        `b.size()` bytes may be produced; the
+        serializer then sends them, and asks for
+        more afterwards.
+
+        @param bytes The number of bytes
+        placed in the buffer.
+
+        @param finished `true` if there
+        is no more data.
+
+        @param ec The error, if any occurred.
+    */
+    void
+    complete(
+        std::size_t bytes,
+        bool finished,
+        system::error_code ec = {}) noexcept;
+
+private:
+    enum : int
+    {
+        idle,
+        starting,
+        pending,
+        done
+    };
+
+    results
+    on_read(
+        buffers::mutable_buffer b) override final;
+
+    results take(buffers::mutable_buffer b) noexcept;
+
+    std::atomic<int> state_;
+    handler* h_ = nullptr;
+    buffers::mutable_buffer b_;
+    results rv_;
+};
+
+} // http_proto
+} // boost
+
+#endif
@@ -0,0 +1,190 @@
+//
+// Copyright (c) 2026 agent (agent@local)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/cppalliance/http_proto
+//
+
+#ifndef BOOST_HTTP_PROTO_DIGEST_HPP
+#define BOOST_HTTP_PROTO_DIGEST_HPP
+
+#include <boost/http_proto/detail/config.hpp>
+#include <boost/core/detail/string_view.hpp>
+#include <cstddef>
+#include <string>
+
+namespace boost {
+namespace http_proto {
+
+/** The algorithms for computing a body digest
+
+    @see
+        @ref digest,
+        @ref serializer::compute_digest,
+        @ref parser::compute_digest.
+*/
+enum class digest_algorithm
+{
+    /// No digest is computed
+    none = 0,
+
+    /// CRC-32C (Castagnoli), 4 bytes
+    crc32c,
+
+    /// SHA-256, 32 bytes
+    sha256
+};
+
+/** Return the name of a digest algorithm
+
+    The name is the key used for the algorithm
+    in the `Content-Digest` and `Repr-Digest`
+    fields of RFC 9530, or an empty string for
+    @ref digest_algorithm::none.
+*/
+BOOST_HTTP_PROTO_DECL
+core::string_view
+to_string(digest_algorithm alg) noexcept;
+
+/** The digest of a message body
+
+    A digest is computed over the body as it
+    is sent or received, after any chunked
+    framing is removed and with any content
+    coding applied, which makes it the value
+    of the `Content-Digest` field.
+
+    A CRC-32C is stored as 4 bytes in
+    big-endian order.
+
+    @par Example
+    @code
+    sr.compute_digest( digest_algorithm::sha256 );
+    sr.start( res, buffers::const_buffer( body.data(), body.size() ) );
+    // ... send the message
+
+    // "sha-256=:ungWv48Bz+pBQUDeXa4iI7ADYaOWF3qctBD/YfIAFa0=:"
+    std::string v = sr.body_digest().to_field_value();
+    @endcode
+
+    @see
+        @ref serializer::body_digest,
+        @ref parser::body_digest.
+*/
+class digest
+{
+public:
+    /** The largest size of any digest
+    */
+    static constexpr std::size_t max_size = 32;
+
+    /** Constructor
+
+        Default-constructed digests
+        have no algorithm and are empty.
+    */
+    digest() noexcept
+        : alg_(digest_algorithm::none)
+        , v_{}
+    {
+    }
+
+    /** Constructor
+
+        @param alg The algorithm which
+        produced the digest.
+
+        @param data The bytes of the digest,
+        whose number is determined by `alg`.
+    */
+    BOOST_HTTP_PROTO_DECL
+    digest(
+        digest_algorithm alg,
+        unsigned char const* data) noexcept;
+
+    /** Return the algorithm which produced the digest
+    */
+    digest_algorithm
+    algorithm() const noexcept
+    {
+        return alg_;
+    }
+
+    /** Return the number of bytes in the digest
+    */
+    BOOST_HTTP_PROTO_DECL
+    std::size_t
+    size() const noexcept;
+
+    /** Return true if there is no digest
+    */
+    bool
+    empty() const noexcept
+    {
+        return alg_ == digest_algorithm::none;
+    }
+
+    /** Return a pointer to the bytes of the digest
+    */
+    unsigned char const*
+    data() const noexcept
+    {
+        return v_;
+    }
+
+    /** Return the digest as lowercase hexadecimal
+    */
+    BOOST_HTTP_PROTO_DECL
+    std::string
+    to_hex() const;
+
+    /** Return the digest as a field value
+
+        The value is a dictionary member as
+        defined in RFC 9530, which may be used
+        for a `Content-Digest` field in the
+        header or in the trailer, for example
+        `sha-256=:ungWv48Bz+pBQUDeXa4iI7ADYaOWF3qctBD/YfIAFa0=:`.
+        An empty digest returns an empty string.
+    */
+    BOOST_HTTP_PROTO_DECL
+    std::string
+    to_field_value() const;
+
+    /** Return true if two digests are equal
+    */
+    friend
+    bool
+    operator==(
+        digest const& a,
+        digest const& b) noexcept
+    {
+        return a.equals(b);
+    }
+
+    /** Return true if two digests are not equal
+    */
+    friend
+    bool
+    operator!=(
+        digest const& a,
+        digest const& b) noexcept
+    {
+        return ! a.equals(b);
+    }
+
+private:
+    BOOST_HTTP_PROTO_DECL
+    bool
+    equals(digest const& other) const noexcept;
+
+    digest_algorithm alg_;
+    unsigned char v_[max_size];
+};
+
+} // http_proto
+} // boost
+
+#endif
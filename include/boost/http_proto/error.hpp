@@ -48,6 +48,10 @@ enum class error
     */
    need_data,
 
+    /** The operation waits for pending I/O to complete
+    */
+   would_block,
+
     //--------------------------------------------
     //
     // Syntax errors (unrecoverable)
@@ -187,7 +191,16 @@ enum class error
     /**
      *  A dynamic buffer's maximum size would be exceeded
     */
-   buffer_overflow
+   buffer_overflow,
+
+    /** No acceptable representation
+
+        The client refused every content coding
+        which is available, including identity.
+        A server usually responds with 406
+        (Not Acceptable).
+    */
+   not_acceptable
 };
 
 // VFALCO we need a bad_message condition?
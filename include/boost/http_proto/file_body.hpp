@@ -14,11 +14,18 @@
 #include <boost/http_proto/file.hpp>
 #include <boost/http_proto/sink.hpp>
 #include <boost/http_proto/source.hpp>
+#include <boost/core/detail/string_view.hpp>
+#include <boost/system/error_code.hpp>
 #include <cstdint>
+#include <memory>
 
 namespace boost {
 namespace http_proto {
 
+#ifndef BOOST_HTTP_PROTO_DOCS
+class message_base;
+#endif
+
 class BOOST_SYMBOL_VISIBLE
     file_body
     : public source, sink
@@ -26,6 +33,14 @@ class BOOST_SYMBOL_VISIBLE
     file f_;
     std::uint64_t n_;
 
+    // bounce buffer for direct I/O
+    std::unique_ptr<unsigned char[]> dbuf_;
+    unsigned char* dp_ = nullptr;
+    std::size_t dsize_ = 0;
+    std::size_t dbegin_ = 0;
+    std::size_t dend_ = 0;
+    bool dinit_ = false;
+
 public:
     file_body() = delete;
     file_body(
@@ -45,6 +60,36 @@ public:
         std::uint64_t size =
             std::uint64_t(-1)) noexcept;
 
+    /** Read the file with direct I/O
+
+        The page cache is bypassed when reading,
+        so that sending a very large file does not
+        evict data which other parts of the program
+        are using. Data is read in aligned blocks,
+        directly into the serializer's buffer when
+        it is suitably aligned and otherwise into
+        a buffer owned by the body, so the file
+        position and size need not be aligned.
+
+        This must be called before the body is
+        read. Writing is not affected.
+
+        @param buffer_size The size of the buffer
+        used for unaligned reads. It is rounded up
+        to a multiple of
+        @ref file_posix::direct_alignment.
+
+        @param ec Set to the error, if any occurred.
+        If the file does not support direct I/O,
+        an error is set and the body is read
+        normally.
+    */
+    BOOST_HTTP_PROTO_DECL
+    void
+    set_direct(
+        std::size_t buffer_size,
+        system::error_code& ec);
+
     BOOST_HTTP_PROTO_DECL
     source::results
     on_read(
@@ -54,8 +99,89 @@ public:
     sink::results
     on_write(
         buffers::const_buffer b, bool more) override;
+
+    BOOST_HTTP_PROTO_DECL
+    sink::results
+    on_write(
+        buffers::const_buffer_span bs, bool more) override;
+
+    BOOST_HTTP_PROTO_DECL
+    void
+    on_size_hint(std::uint64_t n) noexcept override;
+
+private:
+    source::results
+    read_direct(buffers::mutable_buffer b);
+
+    void
+    fill_direct(system::error_code& ec);
 };
 
+//------------------------------------------------
+
+/** Open the best precompressed variant of a file
+
+    Given the value of a request's Accept-Encoding
+    field, this function opens the most preferred
+    precompressed sibling of `path` which exists
+    on disk and is acceptable to the client. The
+    siblings are tried in this order:
+
+    @li `path` with ".br" appended, for `br`
+    @li `path` with ".zst" appended, for `zstd`
+    @li `path` with ".gz" appended, for `gzip`
+
+    Codings with a higher qvalue in `accept_encoding`
+    are preferred over this order, and a sibling is
+    skipped when identity is listed with a higher
+    qvalue. When no acceptable sibling exists, or
+    identity is preferred, `path` itself is opened, unless
+    identity is refused with "identity;q=0" or
+    "*;q=0". Then @ref error::not_acceptable is
+    set, so that the caller can respond with
+    406 (Not Acceptable).
+
+    The Content-Encoding and Content-Length of `m`
+    are set to describe the opened file, and
+    "Accept-Encoding" is added to Vary. The returned
+    body reads exactly the file's contents, and is
+    sent without applying a compression encoding
+    in the serializer.
+
+    @par Example
+    @code
+    error_code ec;
+    auto body = open_precompressed(
+        "www/index.html",
+        req.value_or( field::accept_encoding, "" ),
+        res,
+        ec );
+    if(! ec )
+        sr.start< file_body >( res, std::move(body) );
+    @endcode
+
+    @return The body to send.
+
+    @param path The path of the uncompressed file.
+
+    @param accept_encoding The value of the
+    Accept-Encoding field of the request. Malformed
+    values are treated as accepting only identity.
+
+    @param m The message whose fields are set.
+
+    @param ec Set to the error, if any occurred,
+    or to @ref error::not_acceptable if neither
+    a sibling nor `path` is acceptable.
+*/
+BOOST_HTTP_PROTO_DECL
+file_body
+open_precompressed(
+    core::string_view path,
+    core::string_view accept_encoding,
+    message_base& m,
+    system::error_code& ec);
+
 } // http_proto
 } // boost
 
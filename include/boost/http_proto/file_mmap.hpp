@@ -0,0 +1,119 @@
+//
+// Copyright (c) 2026 agent (agent@local)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/cppalliance/http_proto
+//
+
+#ifndef BOOST_HTTP_PROTO_FILE_MMAP_HPP
+#define BOOST_HTTP_PROTO_FILE_MMAP_HPP
+
+#include <boost/http_proto/detail/config.hpp>
+#include <boost/http_proto/file_posix.hpp>
+
+#if BOOST_HTTP_PROTO_USE_POSIX_FILE
+
+#include <boost/http_proto/view_source.hpp>
+#include <cstddef>
+#include <cstdint>
+
+namespace boost {
+namespace http_proto {
+
+/** A view source which sends a file from memory mappings
+
+    The file is mapped in windows of at most
+    `window_size` bytes, and the mapped pages are
+    handed to the serializer without copying.
+    The kernel is advised that each window is
+    read sequentially and will be needed soon,
+    and pages are unmapped as soon as they have
+    been consumed.
+
+    This is most effective for files which are
+    already in the page cache, as it removes the
+    copy and the system call made for each
+    buffer-full by @ref file_body.
+
+    @par Example
+    @code
+    file_posix f;
+    f.open( "index.html", file_mode::scan, ec );
+    sr.start_view< file_mmap >( res, std::move(f) );
+    @endcode
+
+    @note The file must not be truncated while
+    it is being sent, or reading the mapped
+    pages raises `SIGBUS`.
+*/
+class BOOST_SYMBOL_VISIBLE
+    file_mmap
+    : public view_source
+{
+    file_posix f_;
+    std::uint64_t n_;
+    std::size_t window_;
+
+    std::uint64_t pos_ = 0;
+    std::uint64_t end_ = 0;
+    bool init_ = false;
+
+    // the current mapping, starting
+    // at a page-aligned file offset
+    unsigned char* map_ = nullptr;
+    std::size_t map_size_ = 0;
+    std::uint64_t map_pos_ = 0;
+
+public:
+    file_mmap() = delete;
+    file_mmap(
+        file_mmap const&) = delete;
+    file_mmap& operator=(
+        file_mmap const&) = delete;
+
+    /** Destructor
+
+        Any mapping is released.
+    */
+    BOOST_HTTP_PROTO_DECL
+    ~file_mmap();
+
+    /** Constructor
+
+        @param f The open file. The data starts
+        at the file's current position.
+
+        @param size The number of bytes to send.
+        If this is `std::uint64_t(-1)`, the rest
+        of the file is sent.
+
+        @param window_size The largest number of
+        bytes mapped at once.
+    */
+    BOOST_HTTP_PROTO_DECL
+    explicit
+    file_mmap(
+        file_posix&& f,
+        std::uint64_t size = std::uint64_t(-1),
+        std::size_t window_size = 16 * 1024 * 1024) noexcept;
+
+private:
+    BOOST_HTTP_PROTO_DECL
+    results
+    on_prepare() override;
+
+    BOOST_HTTP_PROTO_DECL
+    void
+    on_consume(std::size_t n) noexcept override;
+
+    void unmap(std::size_t n) noexcept;
+};
+
+} // http_proto
+} // boost
+
+#endif
+
+#endif
@@ -30,6 +30,7 @@
 
 #include <boost/http_proto/error.hpp>
 #include <boost/http_proto/file_base.hpp>
+#include <boost/buffers/const_buffer_span.hpp>
 #include <boost/system/error_code.hpp>
 #include <cstdint>
 
@@ -43,6 +44,7 @@ namespace http_proto {
 class file_posix
 {
     int fd_ = -1;
+    bool direct_ = false;
 
     BOOST_HTTP_PROTO_DECL
     static
@@ -183,6 +185,86 @@ public:
     BOOST_HTTP_PROTO_DECL
     std::size_t
     write(void const* buffer, std::size_t n, system::error_code& ec);
+
+    /** Write a buffer sequence to the open file
+
+        The buffers are written with as few calls
+        to `writev` as possible.
+
+        @param bs The buffers holding the data to write
+
+        @param ec Set to the error, if any occurred
+
+        @return The number of bytes written
+    */
+    BOOST_HTTP_PROTO_DECL
+    std::size_t
+    write(buffers::const_buffer_span bs, system::error_code& ec);
+
+    /** Allocate storage for data which will be written
+
+        Disk space for `n` bytes starting at the
+        current position is reserved without
+        changing the size of the file, which
+        reduces fragmentation when a large file
+        is written sequentially. This has no effect
+        where the system or file system does not
+        support it.
+
+        @param n The number of bytes to reserve
+
+        @param ec Set to the error, if any occurred
+    */
+    BOOST_HTTP_PROTO_DECL
+    void
+    preallocate(std::uint64_t n, system::error_code& ec);
+
+    /** Enable or disable direct I/O
+
+        In direct mode reads and writes bypass the
+        page cache, so that streaming a very large
+        file does not evict data which other parts
+        of the program are using. On Linux this sets
+        `O_DIRECT`, which requires the buffer address,
+        the file position and the number of bytes
+        to be multiples of @ref direct_alignment,
+        except that a read may end at the end of
+        the file. Where the system cannot bypass
+        the cache, an error is returned.
+
+        @param on `true` to enable direct I/O.
+
+        @param ec Set to the error, if any occurred
+
+        @see
+            @ref file_body::set_direct.
+    */
+    BOOST_HTTP_PROTO_DECL
+    void
+    set_direct(bool on, system::error_code& ec);
+
+    /** Return true if direct I/O is enabled
+
+        @see @ref set_direct.
+    */
+    bool
+    is_direct() const noexcept
+    {
+        return direct_;
+    }
+
+    /** Return the alignment required for direct I/O
+
+        This is a multiple of the logical
+        block size of common storage devices.
+    */
+    static
+    constexpr
+    std::size_t
+    direct_alignment() noexcept
+    {
+        return 4096;
+    }
 };
 
 } // http_proto
@@ -0,0 +1,53 @@
+//
+// Copyright (c) 2026 agent (agent@local)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/cppalliance/http_proto
+//
+
+#ifndef BOOST_HTTP_PROTO_FILE_REGION_HPP
+#define BOOST_HTTP_PROTO_FILE_REGION_HPP
+
+#include <boost/http_proto/detail/config.hpp>
+#include <boost/http_proto/file.hpp>
+#include <cstdint>
+
+namespace boost {
+namespace http_proto {
+
+/** A contiguous range of bytes in an open file
+
+    A serializer started with a file region
+    does not read the file. Instead, the I/O
+    layer sends the bytes directly from the
+    file, for example using `sendfile(2)` or
+    `splice(2)` on POSIX or `TransmitFile`
+    on Windows, so that the body never
+    crosses user space.
+
+    A value-initialized region is empty.
+
+    @see
+        @ref serializer::region.
+*/
+struct file_region
+{
+    /** The native handle of the open file
+    */
+    file::native_handle_type handle;
+
+    /** The offset of the first byte in the file
+    */
+    std::uint64_t offset;
+
+    /** The number of bytes
+    */
+    std::uint64_t size;
+};
+
+} // http_proto
+} // boost
+
+#endif
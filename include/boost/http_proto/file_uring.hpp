@@ -0,0 +1,271 @@
+//
+// Copyright (c) 2026 agent (agent@local)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/cppalliance/http_proto
+//
+
+#ifndef BOOST_HTTP_PROTO_FILE_URING_HPP
+#define BOOST_HTTP_PROTO_FILE_URING_HPP
+
+#include <boost/http_proto/detail/config.hpp>
+#include <boost/http_proto/service/uring_service.hpp>
+
+#if BOOST_HTTP_PROTO_USE_IO_URING
+
+#include <boost/http_proto/context.hpp>
+#include <boost/http_proto/error.hpp>
+#include <boost/http_proto/file_base.hpp>
+#include <boost/http_proto/file_posix.hpp>
+#include <boost/system/error_code.hpp>
+#include <cstdint>
+
+namespace boost {
+namespace http_proto {
+
+/** An implementation of File which performs I/O on an io_uring.
+
+    Reads and writes are submitted to the
+    @ref uring_service installed on the context.
+    The synchronous members of the <em>File</em>
+    interface wait for the operation to complete,
+    while @ref async_read and @ref async_write
+    return immediately. Opening, closing and
+    seeking use the same system calls as
+    @ref file_posix.
+
+    @see
+        @ref uring_body.
+*/
+class file_uring
+{
+    uring_service* svc_;
+    file_posix f_;
+
+public:
+    /** The type of the underlying file handle.
+
+        This is platform-specific.
+    */
+    using native_handle_type = int;
+
+    /** Constructor
+
+        There is no open file initially.
+
+        @param ctx The context holding the
+        @ref uring_service.
+
+        @throw std::invalid_argument The
+        service does not exist on the context.
+    */
+    BOOST_HTTP_PROTO_DECL
+    explicit
+    file_uring(context& ctx);
+
+    /** Constructor
+
+        @param ctx The context holding the
+        @ref uring_service.
+
+        @param f The open file to use.
+
+        @throw std::invalid_argument The
+        service does not exist on the context.
+    */
+    BOOST_HTTP_PROTO_DECL
+    file_uring(
+        context& ctx,
+        file_posix&& f);
+
+    /** Constructor
+
+        The moved-from object behaves as if
+        constructed without an open file.
+    */
+    file_uring(
+        file_uring&& other) noexcept = default;
+
+    /** Assignment
+
+        The moved-from object behaves as if
+        constructed without an open file.
+    */
+    file_uring&
+    operator=(
+        file_uring&& other) noexcept = default;
+
+    /// Returns the service performing the I/O.
+    uring_service&
+    service() const noexcept
+    {
+        return *svc_;
+    }
+
+    /// Returns the native handle associated with the file.
+    native_handle_type
+    native_handle() const
+    {
+        return f_.native_handle();
+    }
+
+    /** Set the native handle associated with the file.
+
+        If the file is open it is first closed.
+
+        @param fd The native file handle to assign.
+    */
+    void
+    native_handle(native_handle_type fd)
+    {
+        f_.native_handle(fd);
+    }
+
+    /// Returns `true` if the file is open
+    bool
+    is_open() const
+    {
+        return f_.is_open();
+    }
+
+    /** Close the file if open
+
+        @param ec Set to the error, if any occurred.
+    */
+    void
+    close(system::error_code& ec)
+    {
+        f_.close(ec);
+    }
+
+    /** Open a file at the given path with the specified mode
+
+        @param path The utf-8 encoded path to the file
+
+        @param mode The file mode to use
+
+        @param ec Set to the error, if any occurred
+    */
+    void
+    open(char const* path, file_mode mode, system::error_code& ec)
+    {
+        f_.open(path, mode, ec);
+    }
+
+    /** Return the size of the open file
+
+        @param ec Set to the error, if any occurred
+
+        @return The size in bytes
+    */
+    std::uint64_t
+    size(system::error_code& ec) const
+    {
+        return f_.size(ec);
+    }
+
+    /** Return the current position in the open file
+
+        @param ec Set to the error, if any occurred
+
+        @return The offset in bytes from the beginning of the file
+    */
+    std::uint64_t
+    pos(system::error_code& ec) const
+    {
+        return f_.pos(ec);
+    }
+
+    /** Adjust the current position in the open file
+
+        @param offset The offset in bytes from the beginning of the file
+
+        @param ec Set to the error, if any occurred
+    */
+    void
+    seek(std::uint64_t offset, system::error_code& ec)
+    {
+        f_.seek(offset, ec);
+    }
+
+    /** Read from the open file
+
+        This waits for the read to complete.
+        Completions of other operations on the
+        ring may be delivered while waiting.
+
+        @param buffer The buffer for storing the result of the read
+
+        @param n The number of bytes to read
+
+        @param ec Set to the error, if any occurred
+    */
+    BOOST_HTTP_PROTO_DECL
+    std::size_t
+    read(void* buffer, std::size_t n, system::error_code& ec) const;
+
+    /** Write to the open file
+
+        This waits for the write to complete.
+        Completions of other operations on the
+        ring may be delivered while waiting.
+
+        @param buffer The buffer holding the data to write
+
+        @param n The number of bytes to write
+
+        @param ec Set to the error, if any occurred
+    */
+    BOOST_HTTP_PROTO_DECL
+    std::size_t
+    write(void const* buffer, std::size_t n, system::error_code& ec);
+
+    /** Start reading from the open file
+
+        The read begins at the current position,
+        which is advanced by the number of bytes
+        read. The buffer must remain valid until
+        the operation completes.
+
+        @param buffer The buffer for storing the result of the read
+
+        @param n The number of bytes to read
+
+        @param op The operation to notify.
+    */
+    BOOST_HTTP_PROTO_DECL
+    void
+    async_read(
+        void* buffer,
+        std::size_t n,
+        uring_service::operation& op) const;
+
+    /** Start writing to the open file
+
+        The write begins at the current position,
+        which is advanced by the number of bytes
+        written. The buffer must remain valid until
+        the operation completes.
+
+        @param buffer The buffer holding the data to write
+
+        @param n The number of bytes to write
+
+        @param op The operation to notify.
+    */
+    BOOST_HTTP_PROTO_DECL
+    void
+    async_write(
+        void const* buffer,
+        std::size_t n,
+        uring_service::operation& op);
+};
+
+} // http_proto
+} // boost
+
+#endif
+
+#endif
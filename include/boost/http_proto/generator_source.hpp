@@ -0,0 +1,309 @@
+//
+// Copyright (c) 2026 agent (agent@local)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/cppalliance/http_proto
+//
+
+#ifndef BOOST_HTTP_PROTO_GENERATOR_SOURCE_HPP
+#define BOOST_HTTP_PROTO_GENERATOR_SOURCE_HPP
+
+#include <boost/http_proto/detail/config.hpp>
+
+#if ! defined(BOOST_HTTP_PROTO_HAS_COROUTINES)
+# if defined(__cpp_impl_coroutine) && \
+    __cpp_impl_coroutine >= 201902L && \
+    defined(__has_include)
+#  if __has_include(<coroutine>)
+#   define BOOST_HTTP_PROTO_HAS_COROUTINES 1
+#  endif
+# endif
+#endif
+
+#if ! defined(BOOST_HTTP_PROTO_HAS_COROUTINES)
+# define BOOST_HTTP_PROTO_HAS_COROUTINES 0
+#endif
+
+#if BOOST_HTTP_PROTO_HAS_COROUTINES
+
+#include <boost/http_proto/detail/except.hpp>
+#include <boost/http_proto/source.hpp>
+#include <boost/buffers/const_buffer.hpp>
+#include <boost/buffers/mutable_buffer.hpp>
+#include <coroutine>
+#include <cstddef>
+#include <cstring>
+#include <exception>
+#include <utility>
+
+namespace boost {
+namespace http_proto {
+
+/** A source which produces the body from a coroutine
+
+    The body is written by a C++20 coroutine
+    returning @ref generator_source::body. The
+    coroutine runs when the serializer needs
+    more data, and gives it data in one of two
+    ways:
+
+    @li `co_yield` a `buffers::const_buffer`,
+        which is copied into the serializer's
+        buffer. The memory it refers to must
+        remain valid until the coroutine is
+        resumed.
+
+    @li `co_await generator_source::prepare()`,
+        which returns the free space in the
+        serializer's buffer, followed by
+        `co_yield generator_source::commit(n)`
+        after writing `n` bytes into it. This
+        avoids any intermediate copy.
+
+    The body is finished when the coroutine
+    returns. An exception thrown from the
+    coroutine propagates out of
+    `serializer::prepare`.
+
+    @par Example
+    @code
+    generator_source::body
+    repeat( std::string s, int n )
+    {
+        for( int i = 0; i < n; ++i )
+            co_yield buffers::const_buffer( s.data(), s.size() );
+    }
+
+    generator_source::body
+    zeros( std::size_t n )
+    {
+        while( n > 0 )
+        {
+            auto b = co_await generator_source::prepare();
+            auto m = (std::min)( n, b.size() );
+            std::memset( b.data(), 0, m );
+            co_yield generator_source::commit( m );
+            n -= m;
+        }
+    }
+
+    sr.start< generator_source >( res, repeat( "Hello\n", 1000 ) );
+    @endcode
+
+    This type is only available when the
+    compiler supports coroutines.
+*/
+class generator_source
+    : public source
+{
+public:
+    /** Awaited to obtain the free space in the serializer's buffer
+
+        The returned buffer is never empty.
+    */
+    struct prepare
+    {
+    };
+
+    /** Yielded to report bytes written after @ref prepare
+    */
+    struct commit
+    {
+        /** The number of bytes written
+        */
+        std::size_t n;
+
+        /** Constructor
+        */
+        explicit
+        commit(std::size_t n_) noexcept
+            : n(n_)
+        {
+        }
+    };
+
+    /** The return type of a body coroutine
+    */
+    class body
+    {
+    public:
+        /** The promise type of a body coroutine
+        */
+        class promise_type
+        {
+            friend class generator_source;
+
+            buffers::mutable_buffer out_;
+            buffers::const_buffer in_;
+            std::size_t written_ = 0;
+            std::exception_ptr ep_;
+
+            struct prepare_awaiter
+            {
+                promise_type* p;
+
+                bool
+                await_ready() const noexcept
+                {
+                    return true;
+                }
+
+                void
+                await_suspend(
+                    std::coroutine_handle<>) const noexcept
+                {
+                }
+
+                buffers::mutable_buffer
+                await_resume() const noexcept
+                {
+                    return p->out_;
+                }
+            };
+
+        public:
+            body
+            get_return_object() noexcept
+            {
+                return body(std::coroutine_handle<
+                    promise_type>::from_promise(*this));
+            }
+
+            std::suspend_always
+            initial_suspend() const noexcept
+            {
+                return {};
+            }
+
+            std::suspend_always
+            final_suspend() const noexcept
+            {
+                return {};
+            }
+
+            std::suspend_always
+            yield_value(
+                buffers::const_buffer b) noexcept
+            {
+                in_ = b;
+                return {};
+            }
+
+            std::suspend_always
+            yield_value(commit c)
+            {
+                if(c.n > out_.size())
+                    detail::throw_invalid_argument();
+                written_ = c.n;
+                return {};
+            }
+
+            prepare_awaiter
+            await_transform(prepare) noexcept
+            {
+                return { this };
+            }
+
+            void
+            return_void() const noexcept
+            {
+            }
+
+            void
+            unhandled_exception() noexcept
+            {
+                ep_ = std::current_exception();
+            }
+        };
+
+        /** Constructor
+        */
+        body(body&& other) noexcept
+            : h_(std::exchange(other.h_, nullptr))
+        {
+        }
+
+        body& operator=(body&&) = delete;
+
+        /** Destructor
+        */
+        ~body()
+        {
+            if(h_)
+                h_.destroy();
+        }
+
+    private:
+        friend class generator_source;
+
+        explicit
+        body(std::coroutine_handle<
+            promise_type> h) noexcept
+            : h_(h)
+        {
+        }
+
+        std::coroutine_handle<promise_type> h_;
+    };
+
+    /** Constructor
+
+        @param b The coroutine producing the body.
+    */
+    explicit
+    generator_source(body&& b) noexcept
+        : b_(std::move(b))
+    {
+    }
+
+private:
+    results
+    on_read(
+        buffers::mutable_buffer b) override
+    {
+        results rv;
+        auto& p = b_.h_.promise();
+        for(;;)
+        {
+            // data yielded earlier
+            if(p.in_.size() > 0)
+            {
+                auto n = p.in_.size();
+                if( n > b.size())
+                    n = b.size();
+                std::memcpy(
+                    b.data(), p.in_.data(), n);
+                p.in_ += n;
+                b += n;
+                rv.bytes += n;
+            }
+            if( b.size() == 0 ||
+                b_.h_.done())
+                break;
+
+            p.out_ = b;
+            p.written_ = 0;
+            b_.h_.resume();
+            if(p.ep_)
+                std::rethrow_exception(
+                    std::exchange(p.ep_, nullptr));
+            b += p.written_;
+            rv.bytes += p.written_;
+        }
+        rv.finished =
+            b_.h_.done() &&
+            p.in_.size() == 0;
+        return rv;
+    }
+
+    body b_;
+};
+
+} // http_proto
+} // boost
+
+#endif
+
+#endif
@@ -78,7 +78,17 @@ encoding
     /**
       * Indicates the body has gzip applied.
     */
-    gzip
+    gzip,
+
+    /**
+      * Indicates the body has brotli applied.
+    */
+    br,
+
+    /**
+      * Indicates the body has zstd applied.
+    */
+    zstd
 };
 
 //------------------------------------------------
@@ -15,6 +15,7 @@
 #include <boost/http_proto/detail/header.hpp>
 #include <boost/http_proto/detail/type_traits.hpp>
 #include <boost/http_proto/detail/workspace.hpp>
+#include <boost/http_proto/digest.hpp>
 #include <boost/http_proto/error.hpp>
 #include <boost/http_proto/header_limits.hpp>
 #include <boost/http_proto/sink.hpp>
@@ -39,6 +40,7 @@ class request_parser;
 class response_parser;
 class context;
 namespace detail {
+class digester;
 class filter;
 } // detail
 #endif
@@ -340,6 +342,11 @@ public:
         needs to be read into the internal buffer
         before continuing parsing.
 
+        When `ec == error::would_block`, the Sink
+        is waiting for a write to complete, and
+        this function should be called again
+        once it has.
+
         When `ec == error::end_of_stream`, all
         messages have been parsed, and the stream has
         closed cleanly. The parser can be reused for  
@@ -476,6 +483,42 @@ public:
     void
     set_body_limit(std::uint64_t n);
 
+    /** Compute a digest of the body as it is parsed
+
+        The body bytes are hashed as they are
+        parsed, after chunked framing is removed
+        and before any content coding is decoded,
+        so that the result may be compared with a
+        `Content-Digest` field received in the
+        header or in the trailer. CRC-32C uses the
+        SSE4.2 instruction and SHA-256 uses the
+        SHA extensions, when the processor has them.
+
+        No digest is computed for the next message.
+
+        @par Preconditions
+        This function can be called after
+        @ref start and before parsing the body.
+
+        @param alg The algorithm to use.
+
+        @see
+            @ref body_digest.
+    */
+    BOOST_HTTP_PROTO_DECL
+    void
+    compute_digest(digest_algorithm alg);
+
+    /** Return the digest of the body parsed so far
+
+        The digest is complete once @ref is_complete
+        returns `true`. If @ref compute_digest was
+        not called, an empty digest is returned.
+    */
+    BOOST_HTTP_PROTO_DECL
+    digest
+    body_digest() const noexcept;
+
     /** Return the available body data.
 
         The returned buffer span may become invalid if
@@ -603,6 +646,9 @@ private:
     buffers::const_buffer_pair cbp_;
 
     detail::filter* filter_;
+    detail::digester* digester_ = nullptr;
+    digest_algorithm digest_alg_ =
+        digest_algorithm::none;
     buffers::any_dynamic_buffer* eb_;
     sink* sink_;
 
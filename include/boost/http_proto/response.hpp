@@ -19,6 +19,10 @@
 namespace boost {
 namespace http_proto {
 
+#ifndef BOOST_HTTP_PROTO_DOCS
+class context;
+#endif
+
 /** Container for HTTP responses
 */
 class BOOST_SYMBOL_VISIBLE
@@ -306,6 +310,34 @@ public:
             v);
     }
 
+    /** Set the Date field to the current time
+
+        The current date is copied from the
+        @ref date_service installed on `ctx`,
+        without formatting it. If the response
+        has exactly one Date field whose value
+        has the size of an IMF-fixdate, it is
+        overwritten in place. Otherwise any Date fields are
+        replaced by a new one.
+
+        @par Example
+        @code
+        context ctx;
+        install_date_service( ctx );
+
+        res.set_date_now( ctx );
+        @endcode
+
+        @throw std::invalid_argument The
+        @ref date_service is not installed.
+
+        @param ctx The context holding the
+        date service.
+    */
+    BOOST_HTTP_PROTO_DECL
+    void
+    set_date_now(context& ctx);
+
     /** Swap this with another instance
     */
     void
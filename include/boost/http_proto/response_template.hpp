@@ -0,0 +1,195 @@
+//
+// Copyright (c) 2026 agent (agent@local)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/cppalliance/http_proto
+//
+
+#ifndef BOOST_HTTP_PROTO_RESPONSE_TEMPLATE_HPP
+#define BOOST_HTTP_PROTO_RESPONSE_TEMPLATE_HPP
+
+#include <boost/http_proto/detail/config.hpp>
+#include <boost/http_proto/response.hpp>
+#include <boost/core/detail/string_view.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <vector>
+
+namespace boost {
+namespace http_proto {
+
+/** A pre-serialized response header with patchable slots
+
+    Many responses share the same header except
+    for a few values such as Content-Length,
+    Date or a request id. A template holds the
+    serialized header once, with a field of fixed
+    width reserved for each of these values. For
+    each response the header is copied with
+    @ref apply, which does not parse or format
+    anything, and each slot is then overwritten
+    in place with @ref set.
+
+    Values are right-aligned in their slot, with
+    the leading spaces sent as the optional
+    whitespace which may precede a field value.
+
+    @par Example
+    @code
+    response res;
+    res.set( field::server, "Boost" );
+    res.set( field::content_type, "text/html" );
+
+    // built once
+    response_template const tpl( res, {
+        { "Content-Length", 20 },
+        { "Date", 29 },
+        { "X-Request-Id", 16 } } );
+
+    // for each response
+    tpl.apply( res );
+    tpl.set( res, 0, body.size() );
+    tpl.set( res, 1, date );
+    tpl.set( res, 2, id );
+    sr.start( res, buffers::const_buffer( body.data(), body.size() ) );
+    @endcode
+
+    @par Thread Safety
+    Distinct threads may apply the same
+    template concurrently.
+*/
+class response_template
+{
+public:
+    /** A reserved field
+    */
+    struct slot
+    {
+        /** The name of the field
+        */
+        core::string_view name;
+
+        /** The largest size of a value
+        */
+        std::size_t width;
+    };
+
+    /** Constructor
+
+        The fields of `res` are copied, except
+        that any fields named by the slots are
+        removed and appended again with space
+        reserved for values of the slot width. Each
+        slot initially holds the value "0". If
+        there is a slot for Content-Length,
+        Transfer-Encoding is also removed.
+
+        @throws std::invalid_argument A slot has
+        zero width, or names a field other than
+        Content-Length which affects the semantics
+        of the message, such as Transfer-Encoding.
+
+        @throws system::system_error A name is
+        invalid.
+
+        @param res The response to copy.
+
+        @param slots The slots to reserve. Slots
+        are identified by their index in this list.
+    */
+    BOOST_HTTP_PROTO_DECL
+    response_template(
+        response const& res,
+        std::initializer_list<slot> slots);
+
+    /** Return the header with the initial slot values
+    */
+    response const&
+    get() const noexcept
+    {
+        return res_;
+    }
+
+    /** Return the number of slots
+    */
+    std::size_t
+    size() const noexcept
+    {
+        return slots_.size();
+    }
+
+    /** Copy the header to a response
+
+        When `res` has enough capacity, this copies
+        the serialized header and its index without
+        allocating.
+
+        @param res The response to assign.
+    */
+    BOOST_HTTP_PROTO_DECL
+    void
+    apply(response& res) const;
+
+    /** Set the value of a slot
+
+        The value is written in place, and the
+        index of `res` is updated. For the
+        Content-Length slot, the payload size of
+        `res` is updated as well.
+
+        @par Preconditions
+        `res` was assigned with @ref apply and
+        its fields have not been modified since,
+        other than by calling this function.
+
+        @throws std::invalid_argument `i` is out
+        of range, `res` was not assigned from this
+        template, or the value of Content-Length
+        is not a number.
+
+        @throws std::length_error The value is
+        larger than the width of the slot.
+
+        @param res The response to modify.
+
+        @param i The index of the slot.
+
+        @param value The value to set.
+    */
+    BOOST_HTTP_PROTO_DECL
+    void
+    set(
+        response& res,
+        std::size_t i,
+        core::string_view value) const;
+
+    /** Set the value of a slot to a decimal number
+
+        @see @ref set.
+    */
+    BOOST_HTTP_PROTO_DECL
+    void
+    set(
+        response& res,
+        std::size_t i,
+        std::uint64_t value) const;
+
+private:
+    struct slot_info
+    {
+        std::size_t index; // in the table
+        std::size_t vp;    // value position
+        std::size_t width;
+    };
+
+    response res_;
+    std::vector<slot_info> slots_;
+};
+
+} // http_proto
+} // boost
+
+#endif
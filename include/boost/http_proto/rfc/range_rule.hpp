@@ -0,0 +1,231 @@
+//
+// Copyright (c) 2026 agent (agent@local)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/cppalliance/http_proto
+//
+
+#ifndef BOOST_HTTP_PROTO_RFC_RANGE_RULE_HPP
+#define BOOST_HTTP_PROTO_RFC_RANGE_RULE_HPP
+
+#include <boost/http_proto/detail/config.hpp>
+#include <boost/http_proto/rfc/list_rule.hpp>
+#include <boost/core/detail/string_view.hpp>
+#include <boost/system/result.hpp>
+#include <cstdint>
+
+namespace boost {
+namespace http_proto {
+
+//------------------------------------------------
+
+/** A range in the Range field
+
+    This is either an int-range, which holds
+    the first position and optionally the last
+    position, or a suffix-range, which holds
+    the number of bytes at the end of the
+    representation.
+*/
+struct byte_range_spec
+{
+    /** The first position, or the suffix length
+
+        When @ref is_suffix is `true`, this is
+        the number of bytes at the end of the
+        representation.
+    */
+    std::uint64_t first = 0;
+
+    /** The last position, inclusive
+
+        This is `std::uint64_t(-1)` if the
+        last position is absent.
+    */
+    std::uint64_t last = std::uint64_t(-1);
+
+    /** True if this is a suffix-range
+    */
+    bool is_suffix = false;
+};
+
+//------------------------------------------------
+
+/** A satisfiable range of bytes in a representation
+*/
+struct byte_range
+{
+    /** The offset of the first byte
+    */
+    std::uint64_t offset;
+
+    /** The number of bytes
+    */
+    std::uint64_t size;
+};
+
+//------------------------------------------------
+
+/** Rule to match a range in the Range field
+
+    @par Value Type
+    @code
+    using value_type = byte_range_spec;
+    @endcode
+
+    @par Example
+    @code
+    @endcode
+
+    @par BNF
+    @code
+    range-spec     = int-range
+                   / suffix-range
+                   / other-range
+    int-range      = first-pos "-" [ last-pos ]
+    first-pos      = 1*DIGIT
+    last-pos       = 1*DIGIT
+    suffix-range   = "-" suffix-length
+    suffix-length  = 1*DIGIT
+    @endcode
+
+    An int-range whose last position is less
+    than its first position is invalid. The
+    other-range form is not matched, since it
+    applies only to units other than bytes.
+
+    @par Specification
+    @li <a href="https://www.rfc-editor.org/rfc/rfc9110#section-14.1.1"
+        >14.1.1. Range Specifiers (rfc9110)</a>
+
+    @see
+        @ref byte_range_spec.
+*/
+#ifdef BOOST_HTTP_PROTO_DOCS
+constexpr __implementation_defined__ byte_range_spec_rule;
+#else
+struct byte_range_spec_rule_t
+{
+    using value_type = byte_range_spec;
+
+    BOOST_HTTP_PROTO_DECL
+    auto
+    parse(
+        char const*& it,
+        char const* end) const noexcept ->
+            system::result<value_type>;
+};
+
+constexpr byte_range_spec_rule_t byte_range_spec_rule{};
+#endif
+
+//------------------------------------------------
+
+/** Rule matching the Range field value
+
+    Only the "bytes" range unit is matched.
+
+    @par Value Type
+    @code
+    using value_type = grammar::range< byte_range_spec >;
+    @endcode
+
+    @par Example
+    @code
+    auto rv = grammar::parse( "bytes=0-499, -500", range_rule );
+    @endcode
+
+    @par BNF
+    @code
+    Range             = ranges-specifier
+    ranges-specifier  = range-unit "=" range-set
+    range-unit        = token
+    range-set         = 1#range-spec
+    @endcode
+
+    @par Specification
+    @li <a href="https://www.rfc-editor.org/rfc/rfc9110#section-14.2"
+        >14.2. Range (rfc9110)</a>
+
+    @see
+        @ref byte_range_spec,
+        @ref satisfiable_ranges.
+*/
+#ifdef BOOST_HTTP_PROTO_DOCS
+constexpr __implementation_defined__ range_rule;
+#else
+struct range_rule_t
+{
+    using value_type = grammar::range<
+        byte_range_spec>;
+
+    BOOST_HTTP_PROTO_DECL
+    auto
+    parse(
+        char const*& it,
+        char const* end) const ->
+            system::result<value_type>;
+};
+
+constexpr range_rule_t range_rule{};
+#endif
+
+//------------------------------------------------
+
+/** Compute the satisfiable ranges of a Range field value
+
+    Each range in the field value is resolved
+    against the length of the selected
+    representation. Ranges which are not
+    satisfiable are discarded, and a range
+    which overlaps or adjoins a previous one
+    is merged into it, so that the parts of a
+    multipart response never repeat bytes.
+
+    @par Example
+    @code
+    byte_range ranges[8];
+    auto rv = satisfiable_ranges(
+        req.value_or( field::range, "" ), size, ranges, 8 );
+    if( rv )
+        sr.start_ranges( res, file_region{ fd, 0, size },
+            ranges, *rv );
+    else
+        sr.start( res, file_region{ fd, 0, size } );
+    @endcode
+
+    @return The number of ranges stored in
+    `dest`, which is zero if none of the ranges
+    are satisfiable. An error is returned if
+    the value is invalid, uses a range unit
+    other than "bytes", or has more than `max`
+    satisfiable ranges. In this case the Range
+    field should be ignored.
+
+    @param s The value of the Range field.
+
+    @param length The length of the selected
+    representation.
+
+    @param dest The array to store the ranges in.
+
+    @param max The number of elements in `dest`.
+
+    @par Specification
+    @li <a href="https://www.rfc-editor.org/rfc/rfc9110#section-14.1.2"
+        >14.1.2. Byte Ranges (rfc9110)</a>
+*/
+BOOST_HTTP_PROTO_DECL
+system::result<std::size_t>
+satisfiable_ranges(
+    core::string_view s,
+    std::uint64_t length,
+    byte_range* dest,
+    std::size_t max);
+
+} // http_proto
+} // boost
+
+#endif
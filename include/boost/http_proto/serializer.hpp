@@ -16,14 +16,21 @@
 #include <boost/http_proto/detail/except.hpp>
 #include <boost/http_proto/detail/header.hpp>
 #include <boost/http_proto/detail/workspace.hpp>
+#include <boost/http_proto/digest.hpp>
+#include <boost/http_proto/file_region.hpp>
 #include <boost/http_proto/source.hpp>
+#include <boost/http_proto/view_source.hpp>
 #include <boost/buffers/circular_buffer.hpp>
 #include <boost/buffers/const_buffer_span.hpp>
+#include <boost/buffers/mutable_buffer_pair.hpp>
 #include <boost/buffers/range.hpp>
 #include <boost/buffers/type_traits.hpp>
+#include <boost/core/detail/string_view.hpp>
 #include <boost/system/result.hpp>
+#include <chrono>
 #include <cstdint>
 #include <memory>
+#include <string>
 #include <type_traits>
 #include <utility>
 
@@ -35,9 +42,15 @@ class request;
 class response;
 class request_view;
 class response_view;
+class compression_cache;
+class fields_view_base;
+class message_base;
 class message_view_base;
+struct byte_range;
 namespace detail {
+class digester;
 class filter;
+class spsc_ring;
 } // detail
 #endif
 
@@ -72,6 +85,8 @@ public:
     using const_buffers_type = buffers::const_buffer_span;
 
     struct stream;
+    struct shared_stream;
+    struct sse_stream;
 
     /** Destructor
     */
@@ -130,9 +145,14 @@ public:
         @ref is_done returns `true` results in
         undefined behavior.
 
+        If a compression encoding has been applied
+        and a @ref compression_cache is installed on
+        the context, previously compressed output for
+        an identical body is served from the cache.
+
         @par Constraints
         @code
-        is_const_buffers< ConstBuffers >::value == true
+        buffers::is_const_buffer_sequence< ConstBufferSequence >::value == true
         @endcode
     */
     template<
@@ -170,6 +190,246 @@ public:
         message_view_base const& m,
         Args&&... args);
 
+    /** Prepare the serializer for a new message with a view source
+
+        The body is produced by a @ref view_source
+        constructed in the serializer's internal
+        buffer from `args`. The data it returns is
+        sent without being copied, unless an
+        encoding is applied, and is consumed from
+        the source once it has been serialized.
+
+        Changing the contents of the message
+        after calling this function and before
+        @ref is_done returns `true` results in
+        undefined behavior.
+
+        @return A reference to the constructed
+        source.
+    */
+    template<
+        class ViewSource,
+        class... Args
+#ifndef BOOST_HTTP_PROTO_DOCS
+        ,class = typename std::enable_if<
+            is_view_source<ViewSource>::value>::type
+#endif
+    >
+    ViewSource&
+    start_view(
+        message_view_base const& m,
+        Args&&... args);
+
+    /** Prepare the serializer for a new message with a body in a file
+
+        The body is not read by the serializer.
+        The header and any chunked framing are
+        returned from @ref prepare as usual, while
+        the body is returned from @ref region when
+        it is next to be sent, so that it can be
+        written directly from the file.
+
+        @par Example
+        @code
+        sr.start( res, file_region{ fd, 0, size } );
+        while(! sr.is_done() )
+        {
+            std::size_t n;
+            auto r = sr.region();
+            if( r.size > 0 )
+                n = send_file( sock, r );
+            else
+                n = write_some( sock, sr.prepare().value() );
+            sr.consume( n );
+        }
+        @endcode
+
+        Changing the contents of the message
+        after calling this function and before
+        @ref is_done returns `true` results in
+        undefined behavior.
+
+        @throws std::logic_error A compression
+        encoding was applied.
+
+        @param m The message to serialize.
+
+        @param r The region of the file to send
+        as the body.
+    */
+    BOOST_HTTP_PROTO_DECL
+    void
+    start(
+        message_view_base const& m,
+        file_region const& r);
+
+    /** Prepare the serializer for a partial response from a file
+
+        The status and the fields of `res` are set
+        to describe the selected ranges of the file,
+        which are then sent as described for
+        @ref start with a @ref file_region.
+
+        @li If `n` is zero, the status is 416
+        (Range Not Satisfiable) and the body is
+        empty.
+
+        @li If `n` is one, the status is 206
+        (Partial Content), a Content-Range field
+        is set, and the body is the range.
+
+        @li Otherwise the status is 206 and the
+        body is a "multipart/byteranges" payload.
+        The framing of each part, which includes
+        the value of the Content-Type field of
+        `res`, is formatted in the workspace and
+        returned from @ref prepare, while each
+        range is returned from @ref region.
+
+        Any Transfer-Encoding field is removed and
+        the Content-Length is set, so the body is
+        never chunked.
+
+        @par Example
+        @code
+        byte_range ranges[8];
+        auto rv = satisfiable_ranges( range, size, ranges, 8 );
+        if( rv )
+            sr.start_ranges( res, file_region{ fd, 0, size },
+                ranges, *rv );
+        else
+            sr.start( res, file_region{ fd, 0, size } );
+        @endcode
+
+        @throws std::logic_error A compression
+        encoding was applied.
+
+        @throws std::length_error The framing
+        does not fit in the workspace.
+
+        @param res The response to serialize.
+
+        @param file The selected representation.
+        Ranges are relative to its offset, and its
+        size is the complete length.
+
+        @param ranges The satisfiable ranges, for
+        example from @ref satisfiable_ranges.
+
+        @param n The number of ranges.
+    */
+    BOOST_HTTP_PROTO_DECL
+    void
+    start_ranges(
+        response& res,
+        file_region const& file,
+        byte_range const* ranges,
+        std::size_t n);
+
+    /** Prepare the serializer for a new message with a compressed body of known size
+
+        The entire body is compressed up front using
+        the encoding selected by @ref use_deflate_encoding
+        or @ref use_gzip_encoding, and the Content-Length
+        of `m` is set to the exact size of the compressed
+        output. The header and the compressed octets are
+        then presented together as a single output area,
+        without any chunked framing.
+
+        The compressed octets are stored in the free
+        space of the serializer's internal buffer.
+
+        If @ref skip_incompressible was called and
+        the body is estimated to compress poorly, it
+        is sent as-is instead, with the Content-Length
+        set to its size and the Content-Encoding
+        fields omitted from the serialized header.
+
+        Changing the contents of the message
+        after calling this function and before
+        @ref is_done returns `true` results in
+        undefined behavior.
+
+        @par Preconditions
+        A compression encoding has been applied, and
+        `m` does not use a chunked transfer encoding.
+
+        @par Constraints
+        @code
+        buffers::is_const_buffer_sequence< ConstBufferSequence >::value == true
+        @endcode
+
+        @throws std::logic_error The preconditions
+        are not met.
+
+        @throws std::length_error The compressed output
+        does not fit in the available space.
+
+        @param m The message. Its Content-Length is
+        set to the size of the compressed body.
+
+        @param body The body octets to compress. The
+        sequence only needs to remain valid for the
+        duration of the call.
+    */
+    template<
+        class ConstBufferSequence
+#ifndef BOOST_HTTP_PROTO_DOCS
+        ,class = typename
+            std::enable_if<
+                buffers::is_const_buffer_sequence<
+                    ConstBufferSequence>::value
+                        >::type
+#endif
+    >
+    void
+    start_compressed(
+        message_base& m,
+        ConstBufferSequence const& body)
+    {
+        start_compressed(m, body, {});
+    }
+
+    /** Prepare the serializer for a new message with a compressed body of known size
+
+        This function behaves as the overload
+        without `storage`, except that the compressed
+        octets are written to the caller-provided
+        storage. If `storage` is empty, the free space
+        of the serializer's internal buffer is used.
+
+        The caller is responsible for ensuring that
+        `storage` remains valid until @ref is_done
+        returns `true`, @ref reset is called, or
+        the serializer is destroyed.
+
+        @throws std::length_error The compressed output
+        does not fit in `storage`.
+
+        @param m The message. Its Content-Length is
+        set to the size of the compressed body.
+
+        @param body The body octets to compress.
+
+        @param storage The buffer to hold the
+        compressed octets.
+    */
+    template<
+        class ConstBufferSequence
+#ifndef BOOST_HTTP_PROTO_DOCS
+        ,class = typename
+            std::enable_if<
+                buffers::is_const_buffer_sequence<
+                    ConstBufferSequence>::value
+                        >::type
+#endif
+    >
+    void
+    start_compressed(
+        message_base& m,
+        ConstBufferSequence const& body,
+        buffers::mutable_buffer storage);
+
     //--------------------------------------------
 
     /** Return a new stream for this serializer.
@@ -187,6 +447,249 @@ public:
     start_stream(
         message_view_base const& m);
 
+    /** Return a new stream which may be written from another thread
+
+        This works like @ref start_stream, except
+        that the body is written by one producer
+        thread while another thread, which owns the
+        serializer, sends it. The body is held in a
+        single-producer, single-consumer ring in the
+        serializer's buffer, and neither side takes
+        a lock.
+
+        When the ring is empty, @ref prepare returns
+        @ref error::would_block. The handler set
+        on the stream is notified when data arrives,
+        or when space is freed for the producer, so
+        that neither thread needs to poll.
+
+        After the serializer is destroyed, @ref reset is
+        called, or @ref is_done returns true, the only
+        valid operation on the stream is destruction.
+        The producer must be finished with the stream
+        before then.
+
+        @par Example
+        @code
+        auto ss = sr.start_shared_stream( res );
+        ss.set_handler( &h );
+        std::thread t( [ss]() mutable
+        {
+            // ... ss.prepare(), ss.commit(n)
+            ss.close();
+        } );
+        @endcode
+
+        @param m The message to serialize.
+     */
+    BOOST_HTTP_PROTO_DECL
+    shared_stream
+    start_shared_stream(
+        message_view_base const& m);
+
+    /** An event sent with a @ref sse_stream
+
+        @see
+            @ref sse_stream::write.
+    */
+    struct sse_event
+    {
+        /** The data of the event
+
+            Each line of the data, which may be
+            separated by CRLF, LF, or CR, is sent
+            in its own `data:` field.
+        */
+        core::string_view data;
+
+        /** The type of the event
+
+            If this is empty, no `event:` field
+            is sent and the client dispatches a
+            "message" event.
+        */
+        core::string_view event;
+
+        /** The ID of the event
+
+            If this is empty, no `id:` field
+            is sent.
+        */
+        core::string_view id;
+    };
+
+    /** Options for a stream of server-sent events
+
+        @see
+            @ref start_sse.
+    */
+    struct sse_options
+    {
+        /** The longest time an event may be held
+
+            If this is zero, each event is returned
+            by the next call to @ref prepare and
+            becomes a chunk of its own. Otherwise
+            events are held and sent together once
+            `batch_size` bytes are buffered or this
+            much time has passed since the first of
+            them was written, as described for
+            @ref coalesce_output.
+        */
+        std::chrono::steady_clock::duration max_latency =
+            std::chrono::steady_clock::duration::zero();
+
+        /** The amount of held events which is sent at once
+
+            This only applies when `max_latency`
+            is not zero, and is limited by the size
+            of the serializer's buffer.
+        */
+        std::size_t batch_size = 4096;
+    };
+
+    /** Return a new stream of server-sent events
+
+        The body is a `text/event-stream`, whose
+        events are formatted by the returned stream
+        directly into the serializer's buffer. The
+        header is returned by the first call to
+        @ref prepare without waiting for an event,
+        so that the client sees the stream open at
+        once. After that, @ref prepare returns
+        @ref error::need_data until an event is
+        written.
+
+        The message should use a chunked transfer
+        encoding, and have the fields the client
+        expects, such as `Content-Type` and
+        `Cache-Control`.
+
+        @par Example
+        @code
+        res.set( field::content_type, "text/event-stream" );
+        res.set( field::cache_control, "no-cache" );
+        res.set_chunked( true );
+        auto es = sr.start_sse( res );
+
+        // ... on each update
+        es.write( { json, "update", id } );
+
+        // ... on an idle timer
+        es.ping();
+        @endcode
+
+        After the serializer is destroyed, @ref reset is
+        called, or @ref is_done returns true, the only
+        valid operation on the stream is destruction.
+
+        @throws std::logic_error An encoding was
+        applied, since the compressor would hold
+        the events back.
+
+        @param m The message to serialize.
+
+        @param opt The options for batching events.
+    */
+    BOOST_HTTP_PROTO_DECL
+    sse_stream
+    start_sse(
+        message_view_base const& m,
+        sse_options const& opt);
+
+    /** Return a new stream of server-sent events
+
+        Each event is sent as soon as it is written.
+
+        @param m The message to serialize.
+    */
+    sse_stream
+    start_sse(
+        message_view_base const& m);
+
+    //--------------------------------------------
+
+    /** Queue a message without a body after the current ones
+
+        The serialized header is added to the
+        output area after the messages already
+        started, so that a single gather write
+        from @ref prepare can send several
+        pipelined responses at once.
+
+        @par Preconditions
+        The serializer was started with a
+        message which has no body or whose body
+        is a buffer sequence, no encoding was
+        applied, the first message does not use
+        `Expect: 100-continue`, and @ref is_done
+        returns `false`.
+
+        @throws std::logic_error The
+        preconditions are not met.
+
+        @param m The message. Changing its
+        contents before it is consumed results
+        in undefined behavior.
+
+        @see
+            @ref pending.
+    */
+    void
+    append(
+        message_view_base const& m)
+    {
+        append_impl(m, 0, 0);
+    }
+
+    /** Queue a message with a buffer body after the current ones
+
+        This function behaves as the overload
+        without a body, except that the buffers
+        of `body` are queued after the header.
+        The sequence is copied, while the memory
+        it refers to must remain valid until the
+        message is consumed.
+
+        @par Constraints
+        @code
+        buffers::is_const_buffer_sequence< ConstBufferSequence >::value == true
+        @endcode
+
+        @throws std::logic_error The
+        preconditions are not met.
+
+        @param m The message.
+
+        @param body The body octets.
+    */
+    template<
+        class ConstBufferSequence
+#ifndef BOOST_HTTP_PROTO_DOCS
+        ,class = typename
+            std::enable_if<
+                buffers::is_const_buffer_sequence<
+                    ConstBufferSequence>::value
+                        >::type
+#endif
+    >
+    void
+    append(
+        message_view_base const& m,
+        ConstBufferSequence const& body);
+
+    /** Return the number of messages not yet completely consumed
+
+        This counts the message passed to
+        @ref start together with the messages
+        queued by @ref append. Once the count
+        drops, the oldest pending message and its
+        body may be destroyed.
+    */
+    BOOST_HTTP_PROTO_DECL
+    std::size_t
+    pending() const noexcept;
+
     //--------------------------------------------
 
     /** Return true if serialization is complete.
@@ -203,6 +706,16 @@ public:
         all of the content and return the
         corresponding output buffers.
 
+        If the source returns @ref error::would_block
+        and there is nothing else to send, that
+        error is returned, and this function should
+        be called again once the source is ready.
+
+        At most `IOV_MAX` buffers are returned, or
+        1024 where that limit is not defined, so
+        that the output can always be passed to a
+        single gather write.
+
         @par Preconditions
         @code
         this->is_done() == false
@@ -214,6 +727,67 @@ public:
         system::result<
             const_buffers_type>;
 
+    /** Return the part of the body to send from a file
+
+        When the serializer was started with a
+        @ref file_region, this returns the remaining
+        part of that region once the buffers which
+        precede it have been consumed. Bytes sent
+        from the region are reported by calling
+        @ref consume, and @ref prepare must not be
+        used while the returned region is not empty.
+
+        @return The region to send, or an empty
+        region if the next bytes come from
+        @ref prepare.
+    */
+    BOOST_HTTP_PROTO_DECL
+    file_region
+    region() const noexcept;
+
+    /** Return true if the last output area ends the message
+
+        This returns true when consuming all of
+        the buffers returned by the last successful
+        call to @ref prepare completes the message,
+        including any messages queued with
+        @ref append. No further output follows.
+
+        @see
+            @ref expects_more.
+    */
+    bool
+    is_message_end() const noexcept
+    {
+        return is_msg_end_;
+    }
+
+    /** Return true if more output follows the last output area
+
+        This is the opposite of @ref is_message_end.
+        It may be passed to the write as a hint that
+        the output should not be sent as a packet of
+        its own yet, for example with `MSG_MORE` or
+        `TCP_CORK`, so that a header is sent together
+        with the start of the body which follows it.
+
+        @par Example
+        @code
+        auto rv = sr.prepare();
+        // ... check rv
+        ::sendmsg( fd, &msg,
+            sr.expects_more() ? MSG_MORE : 0 );
+        @endcode
+
+        @see
+            @ref is_message_end.
+    */
+    bool
+    expects_more() const noexcept
+    {
+        return ! is_msg_end_;
+    }
+
     /** Consume bytes from the output area.
     */
     BOOST_HTTP_PROTO_DECL
@@ -242,6 +816,339 @@ public:
     void
     use_gzip_encoding();
 
+    /** Options for parallel compression
+
+        @see
+            @ref use_deflate_encoding,
+            @ref use_gzip_encoding.
+    */
+    struct parallel_options
+    {
+        /** The number of body bytes in each block
+
+            Each block is compressed independently,
+            so smaller blocks compress slightly worse.
+        */
+        std::size_t block_size = 128 * 1024;
+
+        /** The number of blocks compressed at once
+
+            If this is zero, one more than the
+            concurrency of the @ref worker_pool
+            is used, or one if no pool is installed.
+            Each block holds its own compressor and
+            two buffers of about `block_size` bytes.
+        */
+        std::size_t max_blocks = 0;
+    };
+
+    /** Applies deflate compression to the current message, in parallel
+
+        The body is split into blocks which are
+        compressed on the @ref worker_pool installed
+        on the context, or on the calling thread if
+        there is none. The output is a single zlib
+        stream, emitted in order.
+
+        After @ref reset is called, compression is not
+        applied to the next message.
+
+        Must be called before any calls to @ref start.
+
+        @param opt The options for splitting the body.
+    */
+    BOOST_HTTP_PROTO_DECL
+    void
+    use_deflate_encoding(
+        parallel_options const& opt);
+
+    /** Applies gzip compression to the current message, in parallel
+
+        The body is split into blocks which are
+        compressed on the @ref worker_pool installed
+        on the context, or on the calling thread if
+        there is none. The output is a single gzip
+        member, emitted in order.
+
+        After @ref reset is called, compression is not
+        applied to the next message.
+
+        Must be called before any calls to @ref start.
+
+        @param opt The options for splitting the body.
+    */
+    BOOST_HTTP_PROTO_DECL
+    void
+    use_gzip_encoding(
+        parallel_options const& opt);
+
+    /** Send incompressible bodies without compression
+
+        Before the header is sent, up to `sample_size`
+        bytes of the body are examined. If the sample
+        is estimated to compress poorly, as is the case
+        for images, archives, or encrypted data, the
+        encoding selected by @ref use_deflate_encoding
+        or @ref use_gzip_encoding is not applied, and
+        the Content-Encoding fields are omitted from
+        the serialized header.
+
+        For the stream style, @ref prepare returns
+        @ref error::need_data until the sample is
+        complete or the stream is closed.
+
+        After @ref reset is called, the check is not
+        applied to the next message.
+
+        Must be called before any calls to @ref start.
+        Has no effect when the message uses
+        `Expect: 100-continue`, since the header is
+        sent before the body.
+
+        @param sample_size The number of body bytes
+        to examine. This is limited by the size of
+        the serializer's buffers.
+    */
+    BOOST_HTTP_PROTO_DECL
+    void
+    skip_incompressible(
+        std::size_t sample_size = 4096);
+
+    /** Compute a digest of the body as it is sent
+
+        The body bytes are hashed as the serializer
+        produces them, after any content coding is
+        applied and before chunked framing is added,
+        so that no second pass over the body is
+        needed. CRC-32C uses the SSE4.2 instruction
+        and SHA-256 uses the SHA extensions, when
+        the processor has them.
+
+        The result is returned by @ref body_digest.
+        It is complete once the last of the body
+        has been returned by @ref prepare, which is
+        indicated by @ref is_message_end. When no
+        encoding is applied to a body of buffers or
+        to a @ref stream, it is complete before the
+        last chunk is prepared, so it may be sent
+        with @ref set_trailer.
+
+        After @ref reset is called, no digest is
+        computed for the next message.
+
+        Must be called before any calls to @ref start.
+        Messages queued with @ref append are not
+        included. A body sent as a @ref file_region
+        is never read, so starting one throws.
+
+        @param alg The algorithm to use.
+    */
+    BOOST_HTTP_PROTO_DECL
+    void
+    compute_digest(digest_algorithm alg);
+
+    /** Return the digest of the body sent so far
+
+        If @ref compute_digest was not called,
+        an empty digest is returned.
+    */
+    BOOST_HTTP_PROTO_DECL
+    digest
+    body_digest() const noexcept;
+
+    /** Send a trailer after a chunked body
+
+        The fields of `trailer` are sent as the
+        trailer section of the last chunk, so that
+        values known only once the body has been
+        produced, such as a `Content-Digest` from
+        @ref body_digest, a `grpc-status`, or a
+        `Server-Timing`, can follow a streamed
+        body without buffering it.
+
+        The serialized fields are sent from the
+        storage of `trailer`, which must remain
+        valid and unchanged until @ref is_done
+        returns `true`. The last chunk itself is
+        kept in the serializer's buffer.
+
+        This may be called after @ref start, and
+        until @ref prepare returns the last chunk.
+        For a body of buffers, which is returned
+        all at once, this is before the first call
+        to @ref prepare. A later call replaces the
+        trailer set by an earlier one.
+
+        @par Example
+        @code
+        auto stream = sr.start_stream( res );
+        // ... write the body
+        trailer.set( "Content-Digest",
+            sr.body_digest().to_field_value() );
+        stream.close( trailer );
+        @endcode
+
+        @throws std::logic_error The message does
+        not use a chunked transfer encoding, the
+        last chunk was already returned, or
+        messages were queued with @ref append.
+
+        @param trailer The trailer fields. Only
+        the fields are sent, so the start line of
+        a message is ignored.
+    */
+    BOOST_HTTP_PROTO_DECL
+    void
+    set_trailer(
+        fields_view_base const& trailer);
+
+    /** Options for coalescing body output
+
+        @see
+            @ref coalesce_output.
+    */
+    struct coalesce_options
+    {
+        /** The smallest amount of body data to send
+
+            While the body is incomplete, output
+            is held until at least this many bytes
+            are buffered. This is limited by the
+            size of the serializer's buffer.
+        */
+        std::size_t min_size = 4096;
+
+        /** The longest time output may be held
+
+            Once this much time has passed since
+            output was first held, it is sent by
+            the next call to @ref prepare even if
+            it is smaller than @ref min_size. If
+            this is zero, output is held until
+            @ref flush is called.
+        */
+        std::chrono::steady_clock::duration max_hold =
+            std::chrono::steady_clock::duration::zero();
+    };
+
+    /** Coalesce small pieces of the body into larger writes
+
+        A @ref source or a @ref stream may provide
+        the body in small pieces, such as lines of
+        a log or rows of a result set. Normally
+        each piece is sent as soon as it arrives,
+        and for a chunked body each one becomes a
+        chunk with its own framing.
+
+        With this option, @ref prepare keeps
+        reading from the source while less than
+        `opt.min_size` bytes are buffered. When
+        the source returns @ref error::would_block,
+        or for the stream style when no more data
+        is committed, the buffered output is held
+        and @ref prepare returns
+        @ref error::would_block or
+        @ref error::need_data respectively. Held
+        output is sent once enough data arrives,
+        when the body is complete, when
+        `opt.max_hold` elapses, or after
+        @ref flush is called.
+
+        The time is only checked when @ref prepare
+        is called, so callers which set a hold time
+        usually also arm a timer which calls
+        @ref flush.
+
+        After @ref reset is called, output is not
+        coalesced for the next message.
+
+        Must be called before any calls to @ref start.
+        Has no effect when an encoding is applied.
+
+        @param opt The options for coalescing.
+    */
+    BOOST_HTTP_PROTO_DECL
+    void
+    coalesce_output(
+        coalesce_options const& opt);
+
+    /** Send held output on the next call to prepare
+
+        Any body output held by
+        @ref coalesce_output is returned by the
+        next call to @ref prepare, regardless of
+        its size. This is useful for streams which
+        are sensitive to latency, such as server
+        sent events.
+    */
+    BOOST_HTTP_PROTO_DECL
+    void
+    flush() noexcept;
+
+    /** Options for shaping output into TLS records
+
+        @see
+            @ref shape_records.
+    */
+    struct record_options
+    {
+        /** The size of the first record of a message
+
+            This is usually small enough that the
+            record fits in one TCP segment, so that
+            the peer can decrypt and process the
+            start of the message early. If this is
+            zero or larger than @ref size, @ref size
+            is used.
+        */
+        std::size_t first_size = 1400;
+
+        /** The size of the following records
+
+            The largest TLS record holds 16384
+            bytes of plaintext. If this is zero,
+            output is not shaped.
+        */
+        std::size_t size = 16384;
+    };
+
+    /** Shape the output area for a TLS stream
+
+        A TLS stream usually encrypts each buffer
+        it is given, or only the first buffer of a
+        sequence, into a separate record. When the
+        header and the body are in separate
+        buffers, the header goes out in a tiny
+        record followed by a full one.
+
+        With this option, @ref prepare returns a
+        single buffer holding no more than the rest
+        of the current record, which is
+        `opt.first_size` bytes for the first record
+        of each message and `opt.size` bytes after
+        that. When the record spans several
+        buffers, such as the header and the start
+        of the body, their bytes are copied into a
+        staging area of `opt.size` bytes taken
+        from the serializer's buffer. A record ends
+        once its bytes have been consumed.
+
+        Unlike the other options, this setting is
+        kept by @ref reset and applies to every
+        following message. It does not apply to
+        the body of a message sent from a file
+        region, and neither such a message nor one
+        with an empty body takes a staging area.
+
+        Must be called before any calls to @ref start.
+
+        @param opt The options for shaping.
+    */
+    BOOST_HTTP_PROTO_DECL
+    void
+    shape_records(
+        record_options const& opt);
+
 private:
     static void copy(
         buffers::const_buffer*,
@@ -290,13 +1197,24 @@ private:
     BOOST_HTTP_PROTO_DECL void start_empty(message_view_base const&);
     BOOST_HTTP_PROTO_DECL void start_buffers(message_view_base const&);
     BOOST_HTTP_PROTO_DECL void start_source(message_view_base const&, source*);
+    BOOST_HTTP_PROTO_DECL void start_view_impl(message_view_base const&, view_source*);
+    BOOST_HTTP_PROTO_DECL void start_compressed_impl(message_base&, buffers::mutable_buffer);
+    BOOST_HTTP_PROTO_DECL buffers::const_buffer* append_impl(
+        message_view_base const&, std::size_t, std::size_t);
+    bool hold_output() noexcept;
+    system::result<const_buffers_type> prepare_impl();
+    void reserve_stage();
+    const_buffers_type shape_output(const_buffers_type) noexcept;
+    bool ends_message(const_buffers_type) const noexcept;
 
     enum class style
     {
         empty,
         buffers,
         source,
-        stream
+        stream,
+        region,
+        view
     };
 
     // chunked-body   = *chunk
@@ -339,6 +1257,8 @@ private:
     detail::array_of_const_buffers buf_;
     detail::filter* filter_ = nullptr;
     source* src_;
+    view_source* vsrc_ = nullptr;
+    buffers::const_buffer view_; // not yet consumed
     context& ctx_;
     buffers::circular_buffer tmp0_;
     buffers::circular_buffer tmp1_;
@@ -352,6 +1272,8 @@ private:
     buffers::circular_buffer* out_ = nullptr;
 
     buffers::const_buffer* hp_;  // header
+    buffers::const_buffer hdr_;  // header to send
+    buffers::const_buffer hdr_identity_; // without Content-Encoding
 
     style st_;
     bool more_;
@@ -361,6 +1283,66 @@ private:
     bool is_expect_continue_;
     bool is_compressed_ = false;
     bool filter_done_ = false;
+
+    // compressed-output cache
+    encoding coding_ = encoding::identity;
+    compression_cache* cache_ = nullptr;
+    std::shared_ptr<std::string const> cached_;
+    detail::array_of_const_buffers cache_body_;
+    std::shared_ptr<std::string> cache_value_;
+
+    // body sent from a file
+    file_region region_{};
+    detail::array_of_const_buffers region_post_;
+
+    // multipart/byteranges parts
+    // after the current region
+    file_region const* part_region_ = nullptr;
+    buffers::const_buffer* part_pre_ = nullptr;
+    std::size_t parts_ = 0;
+
+    // compressibility check
+    std::size_t sample_size_ = 0;
+    bool is_sampling_ = false;
+
+    // messages queued with append, as the
+    // end of each one in bytes consumed
+    std::uint64_t* batch_ends_ = nullptr;
+    std::size_t batch_size_ = 0;
+    std::size_t batch_cap_ = 0;
+    std::size_t batch_done_ = 0;
+    std::uint64_t batch_sent_ = 0;
+    buffers::const_buffer* batch_last_ = nullptr;
+
+    // coalescing of body output
+    std::size_t min_output_ = 0;
+    std::chrono::steady_clock::duration max_hold_{};
+    std::chrono::steady_clock::time_point hold_start_;
+    bool is_holding_ = false;
+    bool flush_ = false;
+
+    // shaping of TLS records
+    std::size_t record_size_ = 0;
+    std::size_t first_record_ = 0;
+    std::size_t record_left_ = 0;
+    buffers::mutable_buffer stage_;
+    buffers::const_buffer shaped_;
+
+    // set by the last call to prepare
+    bool is_msg_end_ = false;
+
+    // the body is a stream of server-sent events
+    bool is_sse_ = false;
+
+    // hashes the body as it is produced
+    detail::digester* digester_ = nullptr;
+
+    // trailer section after the last chunk,
+    // and the two elements which hold them
+    // when the output is prepared up front
+    buffers::const_buffer trailer_;
+    buffers::const_buffer* last_slot_ = nullptr;
+    bool last_chunk_out_ = false;
 };
 
 //------------------------------------------------
@@ -495,6 +1477,24 @@ struct serializer::stream
     void
     close() const;
 
+    /** Close the stream and send a trailer
+
+        This sets the trailer as if by
+        @ref serializer::set_trailer, then
+        closes the stream.
+
+        @exception std::logic_error Thrown if the
+        stream has been previously closed, or if
+        the trailer cannot be sent.
+
+        @param trailer The trailer fields, which
+        must remain valid until the serializer
+        is done.
+    */
+    BOOST_HTTP_PROTO_DECL
+    void
+    close(fields_view_base const& trailer) const;
+
 private:
     friend class serializer;
 
@@ -510,6 +1510,210 @@ private:
 
 //---------------------------------------------------------
 
+/** A stream whose body is written from another thread
+
+    One thread, the producer, writes the body
+    with @ref prepare, @ref commit, and @ref close.
+    The thread which owns the serializer sends it.
+    Copies of a stream refer to the same body.
+
+    @see
+        @ref serializer::start_shared_stream.
+*/
+struct serializer::shared_stream
+{
+    /** Receives notifications for the waiting side
+    */
+    struct handler
+    {
+        /** Called when data is available
+
+            This is called on the producer thread, from
+            @ref commit or @ref close, if the last call
+            to @ref serializer::prepare returned
+            @ref error::would_block. It should arrange
+            for the serializer to be resumed.
+        */
+        virtual
+        void
+        on_data() noexcept = 0;
+
+        /** Called when space is available
+
+            This is called on the serializer's thread,
+            from @ref serializer::consume, if the last
+            call to @ref prepare returned no space. It
+            should arrange for the producer to be
+            resumed.
+        */
+        virtual
+        void
+        on_space() noexcept = 0;
+
+    protected:
+        ~handler() = default;
+    };
+
+    /** Constructor.
+
+        The only valid operations on default constructed
+        streams are assignment and destruction.
+    */
+    shared_stream() = default;
+
+    /** A MutableBufferSequence consisting of a buffer pair.
+     */
+    using buffers_type =
+        buffers::mutable_buffer_pair;
+
+    /** Set the handler for notifications
+
+        This must be called before the producer
+        starts writing.
+
+        @param h The handler, or `nullptr`
+        to not be notified.
+    */
+    BOOST_HTTP_PROTO_DECL
+    void
+    set_handler(handler* h) const noexcept;
+
+    /** Return the free space
+
+        This may only be called by the producer.
+        If the result is empty, the handler is
+        notified when space becomes available.
+    */
+    BOOST_HTTP_PROTO_DECL
+    buffers_type
+    prepare() const noexcept;
+
+    /** Make `n` bytes available to the serializer
+
+        This may only be called by the producer.
+
+        @exception std::logic_error Thrown if `commit` is
+        called with 0.
+
+        @exception std::invalid_argument `n` is greater
+        than the size of the free space.
+    */
+    BOOST_HTTP_PROTO_DECL
+    void
+    commit(std::size_t n) const;
+
+    /** Indicate that no more data is coming
+
+        This may only be called by the producer.
+
+        @exception std::logic_error Thrown if the
+        stream was previously closed.
+    */
+    BOOST_HTTP_PROTO_DECL
+    void
+    close() const;
+
+private:
+    friend class serializer;
+
+    explicit
+    shared_stream(
+        detail::spsc_ring& r) noexcept
+        : r_(&r)
+    {
+    }
+
+    detail::spsc_ring* r_ = nullptr;
+};
+
+//------------------------------------------------
+
+/** A stream of server-sent events
+
+    Events are formatted as described by the
+    HTML Living Standard, directly into the
+    free space of the serializer's buffer,
+    without allocating.
+
+    @see
+        @ref serializer::start_sse.
+*/
+struct serializer::sse_stream
+{
+    /** Constructor.
+
+        The only valid operations on default constructed
+        streams are assignment and destruction.
+    */
+    sse_stream() = default;
+
+    /** Write an event
+
+        @return `true` if the event was written, or
+        `false` if there is not enough free space.
+        In that case, output should be consumed from
+        the serializer before trying again.
+
+        @exception std::logic_error Thrown if the
+        stream has been previously closed.
+
+        @exception std::invalid_argument The type
+        or the ID of the event contains a line break.
+
+        @exception std::length_error The event does
+        not fit in the serializer's buffer.
+
+        @param ev The event to write.
+    */
+    BOOST_HTTP_PROTO_DECL
+    bool
+    write(sse_event const& ev) const;
+
+    /** Write a keep-alive comment
+
+        An empty comment line is written, which
+        clients ignore, and it is returned by the
+        next call to @ref serializer::prepare even
+        if events are being held. This keeps idle
+        connections from being closed by proxies.
+
+        @return `true` if the comment was written,
+        or `false` if there is not enough free space.
+
+        @exception std::logic_error Thrown if the
+        stream has been previously closed.
+    */
+    BOOST_HTTP_PROTO_DECL
+    bool
+    ping() const;
+
+    /** Indicate that no more events are coming
+
+        @exception std::logic_error Thrown if the
+        stream has been previously closed.
+    */
+    BOOST_HTTP_PROTO_DECL
+    void
+    close() const;
+
+private:
+    friend class serializer;
+
+    explicit
+    sse_stream(
+        serializer& sr) noexcept
+        : sr_(&sr)
+    {
+    }
+
+    void
+    commit(std::size_t n) const;
+
+    serializer* sr_ = nullptr;
+};
+
+//---------------------------------------------------------
+
 template<
     class ConstBufferSequence,
     class>
@@ -560,8 +1764,89 @@ start(
     return src;
 }
 
+template<
+    class ViewSource,
+    class... Args,
+    class>
+ViewSource&
+serializer::
+start_view(
+    message_view_base const& m,
+    Args&&... args)
+{
+    static_assert(
+        !std::is_abstract<ViewSource>::value, "");
+    static_assert(
+        std::is_constructible<ViewSource, Args...>::value,
+        "The ViewSource cannot be constructed with the given arguments");
+
+    start_init(m);
+    auto& src = ws_.emplace<ViewSource>(
+        std::forward<Args>(args)...);
+    start_view_impl(m, std::addressof(src));
+    return src;
+}
+
+template<
+    class ConstBufferSequence,
+    class>
+void
+serializer::
+start_compressed(
+    message_base& m,
+    ConstBufferSequence const& body,
+    buffers::mutable_buffer storage)
+{
+    std::size_t n = std::distance(
+        buffers::begin(body),
+        buffers::end(body));
+
+    buf_ = make_array(n);
+    auto p = buf_.data();
+    for(buffers::const_buffer b : buffers::range(body))
+        *p++ = b;
+
+    start_compressed_impl(m, storage);
+}
+
+template<
+    class ConstBufferSequence,
+    class>
+void
+serializer::
+append(
+    message_view_base const& m,
+    ConstBufferSequence const& body)
+{
+    // empty buffers are not queued
+    std::size_t n = 0;
+    std::size_t size = 0;
+    for(buffers::const_buffer b : buffers::range(body))
+    {
+        if(b.size() == 0)
+            continue;
+        ++n;
+        size += b.size();
+    }
+
+    auto p = append_impl(m, n, size);
+    for(buffers::const_buffer b : buffers::range(body))
+        if(b.size() > 0)
+            *p++ = b;
+}
+
 //------------------------------------------------
 
+inline
+auto
+serializer::
+start_sse(
+    message_view_base const& m) ->
+        sse_stream
+{
+    return start_sse(m, sse_options());
+}
+
 inline
 auto
 serializer::
@@ -0,0 +1,240 @@
+//
+// Copyright (c) 2026 agent (agent@local)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/cppalliance/http_proto
+//
+
+#ifndef BOOST_HTTP_PROTO_SERVICE_COMPRESSION_CACHE_HPP
+#define BOOST_HTTP_PROTO_SERVICE_COMPRESSION_CACHE_HPP
+
+#include <boost/http_proto/context.hpp>
+#include <boost/http_proto/detail/config.hpp>
+#include <boost/http_proto/metadata.hpp>
+#include <boost/http_proto/service/service.hpp>
+#include <boost/buffers/const_buffer_span.hpp>
+#include <boost/core/detail/string_view.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+
+namespace boost {
+namespace http_proto {
+
+/** A cache of compressed message bodies
+
+    This service stores the compressed form of
+    message bodies which are sent repeatedly, such
+    as static JSON or HTML documents. Entries are
+    keyed by a hash of the body octets together
+    with the content coding and the compression
+    level, and the body octets are compared on a
+    hit so that a hash collision can never produce
+    the wrong output.
+
+    When the cache is installed, a @ref serializer
+    started with a buffer sequence body and a
+    compression encoding serves previously
+    compressed output without invoking the
+    compressor, and stores the output of a
+    compression which ran to completion.
+
+    The least recently used entries are evicted
+    when the total size of the stored bodies and
+    their compressed output exceeds the budget.
+
+    @par Thread Safety
+    Distinct objects: Safe.<br>
+    Shared objects: Safe.
+
+    @see
+        @ref install_compression_cache.
+*/
+class compression_cache
+    : public service
+{
+public:
+    /** Configuration settings for the cache
+    */
+    struct config
+    {
+        /** The largest number of bytes to store
+
+            This includes the copy of each body
+            kept for comparison, and its compressed
+            output.
+        */
+        std::size_t max_size = 16 * 1024 * 1024;
+
+        /** The largest body which may be stored
+
+            Bodies larger than this are compressed
+            normally and never cached.
+        */
+        std::size_t max_body_size = 1024 * 1024;
+    };
+
+    /** A stored compressed body
+
+        The octets remain valid for as long as a
+        copy of the pointer exists, even if the
+        entry is evicted from the cache.
+    */
+    using value_type =
+        std::shared_ptr<std::string const>;
+
+    /** Constructor
+
+        @param ctx The context which owns the service.
+
+        @param cfg The configuration settings.
+    */
+    BOOST_HTTP_PROTO_DECL
+    compression_cache(
+        context& ctx,
+        config const& cfg);
+
+    /** Destructor
+    */
+    BOOST_HTTP_PROTO_DECL
+    ~compression_cache();
+
+    /** Return the configuration settings
+    */
+    config const&
+    get_config() const noexcept
+    {
+        return cfg_;
+    }
+
+    /** Return the compressed form of a body, if stored
+
+        A successful lookup marks the entry as
+        the most recently used.
+
+        @return The compressed octets, or a null
+        pointer if the body is not stored.
+
+        @param body The uncompressed body octets.
+
+        @param coding The content coding.
+
+        @param level The compression level.
+    */
+    BOOST_HTTP_PROTO_DECL
+    value_type
+    find(
+        buffers::const_buffer_span body,
+        encoding coding,
+        int level);
+
+    /** Store the compressed form of a body
+
+        If the body is larger than the configured
+        limit, or an equal entry already exists,
+        the function has no effect. Otherwise the
+        least recently used entries are evicted
+        until the new entry fits the budget.
+
+        @param body The uncompressed body octets.
+
+        @param coding The content coding.
+
+        @param level The compression level.
+
+        @param compressed The complete compressed
+        output for `body`.
+    */
+    BOOST_HTTP_PROTO_DECL
+    void
+    insert(
+        buffers::const_buffer_span body,
+        encoding coding,
+        int level,
+        core::string_view compressed);
+
+    /** Store the compressed form of a body
+
+        This function behaves as the overload
+        which copies the compressed output, except
+        that the entry takes ownership of
+        `compressed` and no copy is made.
+
+        @throws std::invalid_argument `compressed`
+        is null.
+
+        @param body The uncompressed body octets.
+
+        @param coding The content coding.
+
+        @param level The compression level.
+
+        @param compressed The complete compressed
+        output for `body`.
+    */
+    BOOST_HTTP_PROTO_DECL
+    void
+    insert(
+        buffers::const_buffer_span body,
+        encoding coding,
+        int level,
+        value_type compressed);
+
+    /** Return the number of bytes stored
+    */
+    BOOST_HTTP_PROTO_DECL
+    std::size_t
+    size() const noexcept;
+
+    /** Return the number of entries stored
+    */
+    BOOST_HTTP_PROTO_DECL
+    std::size_t
+    count() const noexcept;
+
+    /** Remove all entries
+    */
+    BOOST_HTTP_PROTO_DECL
+    void
+    clear() noexcept;
+
+private:
+    struct impl;
+
+    config cfg_;
+    std::unique_ptr<impl> impl_;
+};
+
+//------------------------------------------------
+
+/** Install the compressed-output cache on a context
+
+    @par Example
+    @code
+    context ctx;
+    zlib::install_service( ctx );
+    install_compression_cache( ctx, {} );
+    @endcode
+
+    @return A reference to the installed cache.
+
+    @param ctx The context to install the service on.
+
+    @param cfg The configuration settings.
+
+    @throw std::invalid_argument The service
+    already exists on the context.
+*/
+BOOST_HTTP_PROTO_DECL
+compression_cache&
+install_compression_cache(
+    context& ctx,
+    compression_cache::config const& cfg);
+
+} // http_proto
+} // boost
+
+#endif
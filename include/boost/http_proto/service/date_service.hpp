@@ -0,0 +1,153 @@
+//
+// Copyright (c) 2026 agent (agent@local)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/cppalliance/http_proto
+//
+
+#ifndef BOOST_HTTP_PROTO_SERVICE_DATE_SERVICE_HPP
+#define BOOST_HTTP_PROTO_SERVICE_DATE_SERVICE_HPP
+
+#include <boost/http_proto/context.hpp>
+#include <boost/http_proto/detail/config.hpp>
+#include <boost/http_proto/service/service.hpp>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <ctime>
+
+namespace boost {
+namespace http_proto {
+
+/** A cache of the current date for the Date field
+
+    This service holds the current time formatted
+    as an IMF-fixdate, such as
+    "Sun, 06 Nov 1994 08:49:37 GMT". The string is
+    formatted again only when the time in seconds
+    changes, by whichever caller first observes
+    the change, so a busy server formats it at
+    most once per second.
+
+    Readers never block or take a lock. The
+    string is published with a sequence lock,
+    and a reader which overlaps an update
+    simply reads it again.
+
+    @par Thread Safety
+    Distinct objects: Safe.<br>
+    Shared objects: Safe.
+
+    @see
+        @ref install_date_service,
+        @ref response::set_date_now.
+*/
+class date_service
+    : public service
+{
+public:
+    /** The size of an IMF-fixdate
+    */
+    static constexpr std::size_t size = 29;
+
+    /** Constructor
+
+        @param ctx The context which owns the service.
+    */
+    BOOST_HTTP_PROTO_DECL
+    explicit
+    date_service(context& ctx) noexcept;
+
+    /** Destructor
+    */
+    BOOST_HTTP_PROTO_DECL
+    ~date_service();
+
+    /** Copy the current date
+
+        Exactly @ref size characters are written.
+
+        @param dest The destination.
+    */
+    BOOST_HTTP_PROTO_DECL
+    void
+    copy(char* dest) noexcept;
+
+    /** Copy the date for a given time
+
+        This may be used when the caller already
+        knows the current time, such as an event
+        loop which caches it. The cached string
+        is updated if `now` is later than the time
+        it holds, otherwise it is copied as-is, so
+        the date never goes backwards.
+
+        @param dest The destination.
+
+        @param now The current time.
+    */
+    BOOST_HTTP_PROTO_DECL
+    void
+    copy(
+        char* dest,
+        std::time_t now) noexcept;
+
+    /** Format a time as an IMF-fixdate
+
+        Exactly @ref size characters are written.
+
+        @param t The time to format.
+
+        @param dest The destination.
+
+        @par Specification
+        @li <a href="https://www.rfc-editor.org/rfc/rfc9110#section-5.6.7"
+            >5.6.7. Date/Time Formats (rfc9110)</a>
+    */
+    BOOST_HTTP_PROTO_DECL
+    static
+    void
+    format(
+        std::time_t t,
+        char* dest) noexcept;
+
+private:
+    void update(std::time_t now) noexcept;
+
+    // stored as words so that a reader
+    // racing with a writer is well-defined
+    static constexpr std::size_t words = 4;
+
+    std::atomic<std::uint32_t> seq_;
+    std::atomic<std::int64_t> time_;
+    std::atomic<std::uint64_t> buf_[words];
+};
+
+//------------------------------------------------
+
+/** Install the date cache on a context
+
+    @par Example
+    @code
+    context ctx;
+    install_date_service( ctx );
+    @endcode
+
+    @return A reference to the installed service.
+
+    @param ctx The context to install the service on.
+
+    @throw std::invalid_argument The service
+    already exists on the context.
+*/
+BOOST_HTTP_PROTO_DECL
+date_service&
+install_date_service(
+    context& ctx);
+
+} // http_proto
+} // boost
+
+#endif
@@ -0,0 +1,194 @@
+//
+// Copyright (c) 2026 agent (agent@local)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/cppalliance/http_proto
+//
+
+#ifndef BOOST_HTTP_PROTO_SERVICE_URING_SERVICE_HPP
+#define BOOST_HTTP_PROTO_SERVICE_URING_SERVICE_HPP
+
+#include <boost/http_proto/detail/config.hpp>
+
+#if ! defined(BOOST_HTTP_PROTO_USE_IO_URING)
+# if defined(__linux__) && defined(__has_include)
+#  if __has_include(<linux/io_uring.h>)
+#   define BOOST_HTTP_PROTO_USE_IO_URING 1
+#  endif
+# endif
+#endif
+
+#if ! defined(BOOST_HTTP_PROTO_USE_IO_URING)
+# define BOOST_HTTP_PROTO_USE_IO_URING 0
+#endif
+
+#if BOOST_HTTP_PROTO_USE_IO_URING
+
+#include <boost/http_proto/context.hpp>
+#include <boost/http_proto/service/service.hpp>
+#include <cstddef>
+#include <cstdint>
+
+namespace boost {
+namespace http_proto {
+
+/** A Linux io_uring which performs file I/O asynchronously
+
+    File reads and writes are submitted to the
+    ring and complete later, so that disk latency
+    does not stall the thread which runs the
+    serializer or parser. Completions are
+    delivered by calling @ref poll or
+    @ref run_one, typically when the event loop
+    reports that @ref native_handle is readable.
+
+    @par Thread Safety
+    Member functions may not be called
+    concurrently.
+
+    @see
+        @ref install_uring_service,
+        @ref file_uring,
+        @ref uring_body.
+*/
+struct BOOST_HTTP_PROTO_DECL
+    uring_service
+    : service
+{
+    using key_type = uring_service;
+
+    /** An operation submitted to the ring
+
+        Operations are owned by the submitter
+        and must remain valid until
+        @ref on_complete is called.
+    */
+    struct operation
+    {
+        /** Called when the operation completes
+
+            @param res The number of bytes
+            transferred, or a negated `errno`
+            value on failure.
+        */
+        virtual
+        void
+        on_complete(int res) noexcept = 0;
+
+    protected:
+        ~operation() = default;
+    };
+
+    /** Submit a read
+
+        @param fd The file descriptor.
+
+        @param data The buffer to read into.
+
+        @param size The size of the buffer.
+
+        @param offset The offset in the file, or
+        `std::uint64_t(-1)` to read at the current
+        file position and advance it.
+
+        @param op The operation to notify.
+    */
+    virtual
+    void
+    read(
+        int fd,
+        void* data,
+        std::size_t size,
+        std::uint64_t offset,
+        operation& op) = 0;
+
+    /** Submit a write
+
+        @param fd The file descriptor.
+
+        @param data The buffer to write from.
+
+        @param size The size of the buffer.
+
+        @param offset The offset in the file, or
+        `std::uint64_t(-1)` to write at the current
+        file position and advance it.
+
+        @param op The operation to notify.
+    */
+    virtual
+    void
+    write(
+        int fd,
+        void const* data,
+        std::size_t size,
+        std::uint64_t offset,
+        operation& op) = 0;
+
+    /** Deliver completions without blocking
+
+        @return The number of operations
+        which completed.
+    */
+    virtual
+    std::size_t
+    poll() = 0;
+
+    /** Deliver completions, waiting for at least one
+
+        @return The number of operations
+        which completed.
+    */
+    virtual
+    std::size_t
+    run_one() = 0;
+
+    /** Return a descriptor which is readable when completions are ready
+
+        This is an `eventfd` which an event loop
+        can wait on. It is reset by @ref poll
+        and @ref run_one.
+    */
+    virtual
+    int
+    native_handle() const noexcept = 0;
+};
+
+//------------------------------------------------
+
+/** Install an io_uring service on a context
+
+    @par Example
+    @code
+    context ctx;
+    install_uring_service( ctx );
+    @endcode
+
+    @return A reference to the installed service.
+
+    @param ctx The context to install the service on.
+
+    @param entries The number of submission queue
+    entries in the ring.
+
+    @throw std::invalid_argument The service
+    already exists on the context.
+
+    @throw system::system_error The ring could
+    not be created, for example because the
+    kernel does not support io_uring.
+*/
+BOOST_HTTP_PROTO_DECL
+uring_service&
+install_uring_service(
+    context& ctx,
+    unsigned entries = 64);
+
+} // http_proto
+} // boost
+
+#endif
+
+#endif
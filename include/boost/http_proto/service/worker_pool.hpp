@@ -0,0 +1,115 @@
+//
+// Copyright (c) 2026 agent (agent@local)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/cppalliance/http_proto
+//
+
+#ifndef BOOST_HTTP_PROTO_SERVICE_WORKER_POOL_HPP
+#define BOOST_HTTP_PROTO_SERVICE_WORKER_POOL_HPP
+
+#include <boost/http_proto/context.hpp>
+#include <boost/http_proto/detail/config.hpp>
+#include <boost/http_proto/service/service.hpp>
+#include <cstddef>
+
+namespace boost {
+namespace http_proto {
+
+/** A pool of threads which runs CPU-bound work
+
+    The library submits work to this service when
+    an operation can be split into independent
+    parts, such as parallel compression. Callers
+    may install their own implementation to share
+    an existing thread pool, or use
+    @ref install_worker_pool for a default one.
+
+    When no pool is installed on the context,
+    such work runs on the calling thread.
+*/
+struct BOOST_HTTP_PROTO_DECL
+    worker_pool
+    : service
+{
+    using key_type = worker_pool;
+
+    /** A unit of work submitted to the pool
+
+        Work objects are owned by the submitter
+        and must remain valid until @ref run
+        returns.
+    */
+    struct work
+    {
+        /** Perform the work
+
+            This is called exactly once, on
+            any thread.
+        */
+        virtual
+        void
+        run() noexcept = 0;
+
+        /** Link used by implementations to queue pending work
+        */
+        work* next = nullptr;
+
+    protected:
+        ~work() = default;
+    };
+
+    /** Return the number of threads which run work
+    */
+    virtual
+    std::size_t
+    concurrency() const noexcept = 0;
+
+    /** Submit work to the pool
+
+        The pool calls `w.run()` once, on one
+        of its threads, at some later time.
+
+        @param w The work to run.
+    */
+    virtual
+    void
+    post(work& w) = 0;
+};
+
+//------------------------------------------------
+
+/** Install a worker pool on a context
+
+    The pool owns `threads` threads, which are
+    joined when the context is destroyed, after
+    all submitted work has run.
+
+    @par Example
+    @code
+    context ctx;
+    install_worker_pool( ctx, 4 );
+    @endcode
+
+    @return A reference to the installed pool.
+
+    @param ctx The context to install the service on.
+
+    @param threads The number of threads. If this is
+    zero, the number of hardware threads is used.
+
+    @throw std::invalid_argument A worker pool
+    already exists on the context.
+*/
+BOOST_HTTP_PROTO_DECL
+worker_pool&
+install_worker_pool(
+    context& ctx,
+    std::size_t threads = 0);
+
+} // http_proto
+} // boost
+
+#endif
@@ -0,0 +1,129 @@
+//
+// Copyright (c) 2026 agent (agent@local)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/cppalliance/http_proto
+//
+
+#ifndef BOOST_HTTP_PROTO_SHARED_BODY_HPP
+#define BOOST_HTTP_PROTO_SHARED_BODY_HPP
+
+#include <boost/http_proto/detail/config.hpp>
+#include <boost/buffers/const_buffer.hpp>
+#include <memory>
+#include <string>
+#include <utility>
+
+namespace boost {
+namespace http_proto {
+
+/** An immutable body shared by any number of messages
+
+    This is a ConstBufferSequence which holds a
+    reference to its data. Copies refer to the
+    same data, so one body may be sent by many
+    serializers at once, on any threads, without
+    copying it. The data is freed when the last
+    copy is destroyed, which for a serializer
+    happens when it is reset or started again.
+
+    @par Example
+    @code
+    shared_body body( load_snapshot() );
+    for( auto& c : connections )
+        c.sr.start( res, body );
+    @endcode
+*/
+class shared_body
+{
+    std::shared_ptr<void const> p_;
+    buffers::const_buffer cb_;
+
+public:
+    using value_type = buffers::const_buffer;
+    using const_iterator = buffers::const_buffer const*;
+
+    /** Constructor
+
+        The body is empty.
+    */
+    shared_body() = default;
+
+    /** Constructor
+
+        @param s The body, which is moved
+        into shared storage.
+    */
+    explicit
+    shared_body(std::string s)
+        : shared_body(
+            std::make_shared<std::string const>(
+                std::move(s)))
+    {
+    }
+
+    /** Constructor
+
+        @param s The body.
+    */
+    shared_body(
+        std::shared_ptr<std::string const> s) noexcept
+        : cb_(s ? s->data() : nullptr,
+            s ? s->size() : 0)
+    {
+        p_ = std::move(s);
+    }
+
+    /** Constructor
+
+        This refers to memory held by any object,
+        such as a vector or a mapped file.
+
+        @param owner An object which keeps the
+        memory valid while it is referenced.
+
+        @param b The body.
+    */
+    shared_body(
+        std::shared_ptr<void const> owner,
+        buffers::const_buffer b) noexcept
+        : p_(std::move(owner))
+        , cb_(b)
+    {
+    }
+
+    /** Return the number of copies which refer to the body
+    */
+    long
+    use_count() const noexcept
+    {
+        return p_.use_count();
+    }
+
+    /** Return the body
+    */
+    buffers::const_buffer
+    buffer() const noexcept
+    {
+        return cb_;
+    }
+
+    const_iterator
+    begin() const noexcept
+    {
+        return &cb_;
+    }
+
+    const_iterator
+    end() const noexcept
+    {
+        return &cb_ + 1;
+    }
+};
+
+} // http_proto
+} // boost
+
+#endif
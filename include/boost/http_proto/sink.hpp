@@ -16,6 +16,7 @@
 #include <boost/buffers/type_traits.hpp>
 #include <boost/system/error_code.hpp>
 #include <cstddef>
+#include <cstdint>
 #include <type_traits>
 
 namespace boost {
@@ -97,6 +98,24 @@ struct BOOST_HTTP_PROTO_DECL
         return write_impl(bs, more);
     }
 
+    /** Provide the size of the data to be written.
+
+        The parser calls this function when the
+        size of the body is known in advance, such
+        as from the Content-Length of an unencoded
+        message, before the data is written. A sink
+        may use this to allocate storage ahead of
+        time. The size is a hint, and errors are
+        not reported.
+
+        @param n The number of bytes.
+    */
+    void
+    size_hint(std::uint64_t n) noexcept
+    {
+        on_size_hint(n);
+    }
+
 #ifdef BOOST_HTTP_PROTO_DOCS
 protected:
 #else
@@ -169,6 +188,21 @@ private:
         buffers::const_buffer_span bs,
         bool more);
 
+    /** Derived class override.
+
+        This virtual function is called by the
+        implementation, and may be overriden.
+        The default implementation does nothing.
+
+        @param n The number of bytes which
+            will be written.
+
+        @see @ref size_hint.
+    */
+    virtual
+    void
+    on_size_hint(std::uint64_t n) noexcept;
+
 private:
     results
     write_impl(
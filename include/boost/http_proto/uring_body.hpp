@@ -0,0 +1,156 @@
+//
+// Copyright (c) 2026 agent (agent@local)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/cppalliance/http_proto
+//
+
+#ifndef BOOST_HTTP_PROTO_URING_BODY_HPP
+#define BOOST_HTTP_PROTO_URING_BODY_HPP
+
+#include <boost/http_proto/detail/config.hpp>
+#include <boost/http_proto/file_uring.hpp>
+
+#if BOOST_HTTP_PROTO_USE_IO_URING
+
+#include <boost/http_proto/sink.hpp>
+#include <boost/http_proto/source.hpp>
+#include <boost/system/error_code.hpp>
+#include <cstdint>
+#include <memory>
+
+namespace boost {
+namespace http_proto {
+
+/** A body which reads or writes a file without blocking
+
+    Like @ref file_body, this is a @ref source for
+    the serializer and a @ref sink for the parser.
+    Instead of waiting for the disk, it transfers
+    data through its own buffer with operations on
+    the @ref uring_service, and returns
+    @ref error::would_block while an operation is
+    in progress. The serializer and parser report
+    this error without changing their state, and
+    the call can be repeated after the service
+    delivers the completion.
+
+    Content decoding in the parser is not
+    supported with this sink.
+
+    @par Example
+    @code
+    sr.start< uring_body >( res, std::move(f) );
+    for(;;)
+    {
+        auto rv = sr.prepare();
+        if( rv.has_error() &&
+            rv.error() == error::would_block )
+        {
+            // wait for svc.native_handle(),
+            // then deliver the completion
+            svc.poll();
+            continue;
+        }
+        ...
+    }
+    @endcode
+*/
+class BOOST_SYMBOL_VISIBLE
+    uring_body
+    : public source, public sink
+{
+    struct op_type
+        : uring_service::operation
+    {
+        uring_body* self;
+
+        explicit
+        op_type(uring_body* p) noexcept
+            : self(p)
+        {
+        }
+
+        void
+        on_complete(int res) noexcept override;
+    };
+
+    file_uring f_;
+    std::uint64_t n_;
+    std::unique_ptr<unsigned char[]> buf_;
+    std::size_t cap_;
+    op_type op_;
+
+    // the buffered data, or
+    // the data being written
+    std::size_t begin_ = 0;
+    std::size_t end_ = 0;
+    bool pending_ = false;
+    bool writing_ = false;
+    system::error_code ec_;
+
+public:
+    uring_body() = delete;
+    uring_body(
+        uring_body const&) = delete;
+    uring_body& operator=(
+        uring_body const&) = delete;
+
+    /** Destructor
+
+        This waits for an operation in
+        progress to complete.
+    */
+    BOOST_HTTP_PROTO_DECL
+    ~uring_body();
+
+    /** Constructor
+
+        @param f The open file. Data is transferred
+        starting at the file's current position.
+
+        @param size The largest number of bytes
+        to transfer. If this is `std::uint64_t(-1)`,
+        the rest of the file is read, or any
+        amount is written.
+
+        @param buffer_size The size of the buffer
+        used for each operation.
+    */
+    BOOST_HTTP_PROTO_DECL
+    explicit
+    uring_body(
+        file_uring&& f,
+        std::uint64_t size = std::uint64_t(-1),
+        std::size_t buffer_size = 65536);
+
+    /** Return true if an operation is in progress
+    */
+    bool
+    is_pending() const noexcept
+    {
+        return pending_;
+    }
+
+    BOOST_HTTP_PROTO_DECL
+    source::results
+    on_read(
+        buffers::mutable_buffer b) override;
+
+    BOOST_HTTP_PROTO_DECL
+    sink::results
+    on_write(
+        buffers::const_buffer b, bool more) override;
+
+private:
+    void start(bool write) noexcept;
+};
+
+} // http_proto
+} // boost
+
+#endif
+
+#endif
@@ -0,0 +1,137 @@
+//
+// Copyright (c) 2026 agent (agent@local)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/cppalliance/http_proto
+//
+
+#ifndef BOOST_HTTP_PROTO_VIEW_SOURCE_HPP
+#define BOOST_HTTP_PROTO_VIEW_SOURCE_HPP
+
+#include <boost/http_proto/detail/config.hpp>
+#include <boost/buffers/const_buffer.hpp>
+#include <boost/system/error_code.hpp>
+#include <cstddef>
+#include <type_traits>
+
+namespace boost {
+namespace http_proto {
+
+/** An algorithm for producing data without copying
+
+    Unlike a @ref source, which writes into
+    buffers provided by the caller, a view
+    source returns buffers which refer to data
+    that it owns, such as a mapped file. The
+    serializer sends these buffers directly,
+    and reports when each part of the data has
+    been consumed so that the source can release
+    it.
+
+    @par Thread Safety
+    Non-const member functions may not be
+    called concurrently on the same instance.
+
+    @see
+        @ref serializer::start_view.
+*/
+struct BOOST_HTTP_PROTO_DECL
+    view_source
+{
+    /** The results of producing data.
+    */
+    struct results
+    {
+        /** The error, if any occurred.
+        */
+        system::error_code ec;
+
+        /** The data produced.
+        */
+        buffers::const_buffer data;
+
+        /** True if there will be no more data
+            after this.
+        */
+        bool finished = false;
+    };
+
+    /** Produce data.
+
+        The returned data begins at the first
+        byte which has not been consumed, and
+        remains valid until it is consumed.
+
+        @par Preconditions
+        @li All data returned from previous calls
+            has been consumed, and
+        @li There is more data remaining.
+
+        @return The result of the operation. The
+        data is empty only if it is finished or
+        an error occurred.
+    */
+    results
+    prepare()
+    {
+        return on_prepare();
+    }
+
+    /** Release data which is no longer referenced.
+
+        @param n The number of bytes at the beginning
+        of the most recently returned data which
+        will no longer be accessed.
+    */
+    void
+    consume(std::size_t n) noexcept
+    {
+        on_consume(n);
+    }
+
+#ifdef BOOST_HTTP_PROTO_DOCS
+protected:
+#else
+private:
+#endif
+    /** Derived class override.
+
+        @see @ref prepare.
+    */
+    virtual
+    results
+    on_prepare() = 0;
+
+    /** Derived class override.
+
+        @see @ref consume.
+    */
+    virtual
+    void
+    on_consume(std::size_t n) noexcept = 0;
+};
+
+//------------------------------------------------
+
+/** Metafunction which determines if T is a view source
+
+    @see
+        @ref view_source.
+*/
+#ifdef BOOST_HTTP_PROTO_DOCS
+template<class T>
+using is_view_source = __see_below__;
+#else
+template<class T>
+using is_view_source =
+    std::is_convertible<
+        typename std::decay<T>::type*,
+        view_source*>;
+#endif
+
+} // http_proto
+} // boost
+
+#endif
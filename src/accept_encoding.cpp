@@ -0,0 +1,235 @@
+//
+// Copyright (c) 2026 agent (agent@local)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/cppalliance/http_proto
+//
+
+#include <boost/http_proto/accept_encoding.hpp>
+#include <boost/http_proto/fields_view_base.hpp>
+#include <boost/url/grammar/ci_string.hpp>
+#include <boost/url/grammar/parse.hpp>
+#include <cstdint>
+
+#include "detail/encoding_weights.hpp"
+#include "rfc/accept_encoding_rule.hpp"
+
+namespace boost {
+namespace http_proto {
+namespace detail {
+
+namespace {
+
+// Values sent verbatim by common user agents
+char const* const common_values[] = {
+    "gzip, deflate, br, zstd",
+    "gzip, deflate, br",
+    "gzip, deflate",
+    "gzip,deflate",
+    "gzip, br",
+    "br, gzip, deflate",
+    "gzip, deflate, sdch, br",
+    "deflate, gzip",
+    "gzip",
+    "identity",
+    "*"
+};
+
+constexpr std::size_t num_common =
+    sizeof(common_values) / sizeof(common_values[0]);
+
+std::uint32_t
+hash_value(core::string_view s) noexcept
+{
+    // FNV-1a
+    std::uint32_t h = 2166136261u;
+    for(unsigned char c : s)
+        h = (h ^ c) * 16777619u;
+    return h;
+}
+
+struct memo_entry
+{
+    std::uint32_t hash;
+    core::string_view value;
+    encoding_weights weights;
+};
+
+void
+parse_value(
+    encoding_weights& w,
+    core::string_view value) noexcept;
+
+// Weights of the common values, computed
+// once by the parser on first use.
+struct memo
+{
+    memo_entry e[num_common];
+
+    memo() noexcept
+    {
+        for(std::size_t i = 0; i < num_common; ++i)
+        {
+            e[i].value = common_values[i];
+            e[i].hash = hash_value(e[i].value);
+            parse_value(e[i].weights, e[i].value);
+        }
+    }
+
+    memo_entry const*
+    find(core::string_view s) const noexcept
+    {
+        auto const h = hash_value(s);
+        for(auto const& m : e)
+        {
+            if(m.hash == h && m.value == s)
+                return &m;
+        }
+        return nullptr;
+    }
+};
+
+memo const&
+get_memo() noexcept
+{
+    static memo const m;
+    return m;
+}
+
+int
+coding_index(
+    core::string_view coding) noexcept
+{
+    if(grammar::ci_is_equal(coding, "gzip") ||
+        grammar::ci_is_equal(coding, "x-gzip"))
+        return static_cast<int>(encoding::gzip);
+    if(grammar::ci_is_equal(coding, "deflate"))
+        return static_cast<int>(encoding::deflate);
+    if(grammar::ci_is_equal(coding, "br"))
+        return static_cast<int>(encoding::br);
+    if(grammar::ci_is_equal(coding, "zstd"))
+        return static_cast<int>(encoding::zstd);
+    if(grammar::ci_is_equal(coding, "identity"))
+        return static_cast<int>(encoding::identity);
+    return -1;
+}
+
+// a coding listed more than once
+// keeps its highest qvalue
+void
+merge(short& dest, short q) noexcept
+{
+    if(q > dest)
+        dest = q;
+}
+
+void
+parse_value(
+    encoding_weights& w,
+    core::string_view value) noexcept
+{
+    auto rv = grammar::parse(
+        value, accept_encoding_rule);
+    if(! rv)
+        return;
+    for(accept_encoding e : *rv)
+    {
+        auto const q = static_cast<short>(e.q);
+        if(e.coding == "*")
+        {
+            merge(w.any, q);
+            continue;
+        }
+        auto const i = coding_index(e.coding);
+        if(i >= 0)
+            merge(w.q[i], q);
+    }
+}
+
+} // (anon)
+
+void
+encoding_weights::
+add(core::string_view value) noexcept
+{
+    auto const* m = get_memo().find(value);
+    if(! m)
+    {
+        parse_value(*this, value);
+        return;
+    }
+    for(int i = 0; i < size; ++i)
+        merge(q[i], m->weights.q[i]);
+    merge(any, m->weights.any);
+}
+
+} // detail
+
+//------------------------------------------------
+
+namespace {
+
+encoding
+choose(
+    detail::encoding_weights const& w,
+    std::initializer_list<encoding> supported) noexcept
+{
+    encoding best = encoding::identity;
+    unsigned best_q = 0;
+    for(auto e : supported)
+    {
+        auto const q = w.get(e);
+        if(q > best_q)
+        {
+            best = e;
+            best_q = q;
+        }
+    }
+
+    auto const identity_q =
+        w.get(encoding::identity);
+    if(best_q == 0)
+    {
+        if(identity_q == 0)
+            return encoding::unsupported;
+        return encoding::identity;
+    }
+    // an implicit identity never wins
+    // over an acceptable coding
+    bool const listed =
+        w.q[static_cast<int>(
+            encoding::identity)] >= 0 ||
+        w.any >= 0;
+    if(listed && identity_q > best_q)
+        return encoding::identity;
+    return best;
+}
+
+} // (anon)
+
+encoding
+negotiate_encoding(
+    core::string_view value,
+    std::initializer_list<encoding> supported) noexcept
+{
+    detail::encoding_weights w;
+    w.add(value);
+    return choose(w, supported);
+}
+
+encoding
+negotiate_encoding(
+    fields_view_base const& fields,
+    std::initializer_list<encoding> supported) noexcept
+{
+    detail::encoding_weights w;
+    for(auto v : fields.find_all(
+            field::accept_encoding))
+        w.add(v);
+    return choose(w, supported);
+}
+
+} // http_proto
+} // boost
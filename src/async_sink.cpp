@@ -0,0 +1,127 @@
+//
+// Copyright (c) 2026 agent (agent@local)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/cppalliance/http_proto
+//
+
+#include <boost/http_proto/async_sink.hpp>
+#include <boost/http_proto/error.hpp>
+#include <boost/assert.hpp>
+
+namespace boost {
+namespace http_proto {
+
+async_sink::
+async_sink() noexcept
+    : state_(idle)
+{
+}
+
+void
+async_sink::
+complete(
+    std::size_t bytes,
+    system::error_code ec) noexcept
+{
+    BOOST_ASSERT(bytes <= size_);
+    rv_.ec = ec;
+    rv_.bytes = bytes;
+    auto const prev = state_.exchange(
+        done, std::memory_order_acq_rel);
+    BOOST_ASSERT(
+        prev == starting || prev == pending);
+
+    // a completion from within on_start
+    // is returned by on_write directly
+    if( prev == pending && h_ )
+        h_->on_resume();
+}
+
+auto
+async_sink::
+on_write(
+    buffers::const_buffer b,
+    bool more) ->
+        results
+{
+    results rv;
+    switch(state_.load(
+        std::memory_order_acquire))
+    {
+    case pending:
+        rv.ec = error::would_block;
+        return rv;
+
+    case done:
+        // the parser passes the
+        // same data again
+        BOOST_ASSERT(b.size() >= size_);
+        break;
+
+    default:
+        if( start(b, more) )
+        {
+            rv.ec = error::would_block;
+            return rv;
+        }
+        break;
+    }
+
+    for(;;)
+    {
+        auto const r = take();
+        rv.bytes += r.bytes;
+        rv.ec = r.ec;
+        if( rv.ec.failed() ||
+            rv.bytes == b.size() )
+            return rv;
+
+        // a short write, the rest is
+        // written in a new operation
+        auto rest = b;
+        rest += rv.bytes;
+        if( start(rest, more) )
+        {
+            rv.ec = error::would_block;
+            return rv;
+        }
+    }
+}
+
+// Start an operation, returning
+// true if it did not complete
+bool
+async_sink::
+start(
+    buffers::const_buffer b,
+    bool more)
+{
+    size_ = b.size();
+    state_.store(
+        starting, std::memory_order_relaxed);
+    on_start(b, more);
+    int s = starting;
+    return state_.compare_exchange_strong(
+        s, pending,
+        std::memory_order_acq_rel);
+}
+
+// Return the results of a completed operation
+auto
+async_sink::
+take() noexcept ->
+    results
+{
+    auto rv = rv_;
+    size_ = 0;
+    rv_ = {};
+    state_.store(
+        idle, std::memory_order_relaxed);
+    return rv;
+}
+
+} // http_proto
+} // boost
@@ -0,0 +1,121 @@
+//
+// Copyright (c) 2026 agent (agent@local)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/cppalliance/http_proto
+//
+
+#include <boost/http_proto/async_source.hpp>
+#include <boost/http_proto/error.hpp>
+#include <boost/assert.hpp>
+#include <cstring>
+
+namespace boost {
+namespace http_proto {
+
+async_source::
+async_source() noexcept
+    : state_(idle)
+{
+}
+
+void
+async_source::
+complete(
+    std::size_t bytes,
+    bool finished,
+    system::error_code ec) noexcept
+{
+    BOOST_ASSERT(bytes <= b_.size());
+    rv_.ec = ec;
+    rv_.bytes = bytes;
+    rv_.finished = finished;
+    auto const prev = state_.exchange(
+        done, std::memory_order_acq_rel);
+    BOOST_ASSERT(
+        prev == starting || prev == pending);
+
+    // a completion from within on_start
+    // is returned by on_read directly
+    if( prev == pending && h_ )
+        h_->on_resume();
+}
+
+auto
+async_source::
+on_read(
+    buffers::mutable_buffer b) ->
+        results
+{
+    results rv;
+    switch(state_.load(
+        std::memory_order_acquire))
+    {
+    case pending:
+        rv.ec = error::would_block;
+        return rv;
+
+    case done:
+        return take(b);
+
+    default:
+        break;
+    }
+
+    b_ = b;
+    state_.store(
+        starting, std::memory_order_relaxed);
+    on_start(b);
+    int s = starting;
+    if( state_.compare_exchange_strong(
+            s, pending,
+            std::memory_order_acq_rel) )
+    {
+        rv.ec = error::would_block;
+        return rv;
+    }
+    return take(b);
+}
+
+// Return the data of a completed operation
+auto
+async_source::
+take(
+    buffers::mutable_buffer b) noexcept ->
+        results
+{
+    auto rv = rv_;
+    if( b.data() != b_.data() )
+    {
+        // the caller's free space moved,
+        // which happens when its buffer
+        // emptied while the data was read
+        if( rv.bytes > b.size() )
+            rv.bytes = b.size();
+        std::memmove(
+            b.data(), b_.data(), rv.bytes);
+    }
+    if( rv.bytes < rv_.bytes )
+    {
+        // the rest, and any error,
+        // is returned by the next call
+        b_ += rv.bytes;
+        rv_.bytes -= rv.bytes;
+        rv.finished = false;
+        rv.ec = {};
+        return rv;
+    }
+
+    // partial data is returned as-is, and
+    // the next call starts a new operation
+    b_ = {};
+    rv_ = {};
+    state_.store(
+        idle, std::memory_order_relaxed);
+    return rv;
+}
+
+} // http_proto
+} // boost
@@ -0,0 +1,253 @@
+//
+// Copyright (c) 2026 agent (agent@local)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/cppalliance/http_proto
+//
+
+#include "checksum.hpp"
+#include "cpu.hpp"
+#include <cstring>
+
+namespace boost {
+namespace http_proto {
+namespace detail {
+
+namespace {
+
+// reflected CRC-32 polynomial
+constexpr std::uint32_t crc_poly = 0xedb88320;
+
+// reflected CRC-32C polynomial
+constexpr std::uint32_t crc32c_poly = 0x82f63b78;
+
+// largest prime smaller than 65536
+constexpr std::uint32_t adler_base = 65521;
+
+// largest n such that 255n(n+1)/2 + (n+1)(base-1)
+// fits in 32 bits
+constexpr std::size_t adler_nmax = 5552;
+
+struct crc_table
+{
+    std::uint32_t v[256];
+
+    explicit
+    crc_table(std::uint32_t poly) noexcept
+    {
+        for(std::uint32_t i = 0; i < 256; ++i)
+        {
+            std::uint32_t c = i;
+            for(int k = 0; k < 8; ++k)
+                c = (c & 1) ? (poly ^ (c >> 1)) : (c >> 1);
+            v[i] = c;
+        }
+    }
+};
+
+crc_table const&
+get_crc_table() noexcept
+{
+    static crc_table const t(crc_poly);
+    return t;
+}
+
+crc_table const&
+get_crc32c_table() noexcept
+{
+    static crc_table const t(crc32c_poly);
+    return t;
+}
+
+#if BOOST_HTTP_PROTO_USE_X86_INTRINSICS
+
+// The CRC32 instruction computes CRC-32C,
+// eight bytes at a time. The unaligned
+// loads cost nothing on current processors.
+BOOST_HTTP_PROTO_TARGET("sse4.2")
+std::uint32_t
+crc32c_sse42(
+    std::uint32_t crc,
+    unsigned char const* p,
+    std::size_t size) noexcept
+{
+    std::uint64_t c = crc;
+    while(size >= 8)
+    {
+        std::uint64_t v;
+        std::memcpy(&v, p, 8);
+        c = _mm_crc32_u64(c, v);
+        p += 8;
+        size -= 8;
+    }
+    auto c32 = static_cast<std::uint32_t>(c);
+    while(size--)
+        c32 = _mm_crc32_u8(c32, *p++);
+    return c32;
+}
+
+#endif
+
+std::uint32_t
+gf2_matrix_times(
+    std::uint32_t const* mat,
+    std::uint32_t vec) noexcept
+{
+    std::uint32_t sum = 0;
+    while(vec)
+    {
+        if(vec & 1)
+            sum ^= *mat;
+        vec >>= 1;
+        ++mat;
+    }
+    return sum;
+}
+
+void
+gf2_matrix_square(
+    std::uint32_t* square,
+    std::uint32_t const* mat) noexcept
+{
+    for(int n = 0; n < 32; ++n)
+        square[n] = gf2_matrix_times(mat, mat[n]);
+}
+
+} // (anon)
+
+std::uint32_t
+crc32(
+    std::uint32_t crc,
+    void const* data,
+    std::size_t size) noexcept
+{
+    auto const& t = get_crc_table().v;
+    auto p = static_cast<
+        unsigned char const*>(data);
+    crc = ~crc;
+    while(size--)
+        crc = t[(crc ^ *p++) & 0xff] ^ (crc >> 8);
+    return ~crc;
+}
+
+std::uint32_t
+crc32_combine(
+    std::uint32_t crc1,
+    std::uint32_t crc2,
+    std::uint64_t len2) noexcept
+{
+    if(len2 == 0)
+        return crc1;
+
+    std::uint32_t even[32]; // even-power-of-two zeros operator
+    std::uint32_t odd[32];  // odd-power-of-two zeros operator
+
+    // operator for one zero bit
+    odd[0] = crc_poly;
+    std::uint32_t row = 1;
+    for(int n = 1; n < 32; ++n)
+    {
+        odd[n] = row;
+        row <<= 1;
+    }
+
+    // operators for two and four zero bits
+    gf2_matrix_square(even, odd);
+    gf2_matrix_square(odd, even);
+
+    // apply len2 zeros to crc1, the first
+    // square puts the operator for one zero
+    // byte in even
+    do
+    {
+        gf2_matrix_square(even, odd);
+        if(len2 & 1)
+            crc1 = gf2_matrix_times(even, crc1);
+        len2 >>= 1;
+        if(len2 == 0)
+            break;
+
+        gf2_matrix_square(odd, even);
+        if(len2 & 1)
+            crc1 = gf2_matrix_times(odd, crc1);
+        len2 >>= 1;
+    }
+    while(len2 != 0);
+
+    return crc1 ^ crc2;
+}
+
+std::uint32_t
+crc32c(
+    std::uint32_t crc,
+    void const* data,
+    std::size_t size) noexcept
+{
+    auto p = static_cast<
+        unsigned char const*>(data);
+    crc = ~crc;
+#if BOOST_HTTP_PROTO_USE_X86_INTRINSICS
+    if(get_cpu_features().sse42)
+        return ~crc32c_sse42(crc, p, size);
+#endif
+    auto const& t = get_crc32c_table().v;
+    while(size--)
+        crc = t[(crc ^ *p++) & 0xff] ^ (crc >> 8);
+    return ~crc;
+}
+
+std::uint32_t
+adler32(
+    std::uint32_t adler,
+    void const* data,
+    std::size_t size) noexcept
+{
+    auto p = static_cast<
+        unsigned char const*>(data);
+    std::uint32_t a = adler & 0xffff;
+    std::uint32_t b = adler >> 16;
+    while(size > 0)
+    {
+        auto n = size < adler_nmax ?
+            size : adler_nmax;
+        size -= n;
+        while(n--)
+        {
+            a += *p++;
+            b += a;
+        }
+        a %= adler_base;
+        b %= adler_base;
+    }
+    return a | (b << 16);
+}
+
+std::uint32_t
+adler32_combine(
+    std::uint32_t adler1,
+    std::uint32_t adler2,
+    std::uint64_t len2) noexcept
+{
+    auto const rem = static_cast<
+        std::uint32_t>(len2 % adler_base);
+    std::uint32_t sum1 = adler1 & 0xffff;
+    std::uint32_t sum2 = static_cast<std::uint32_t>(
+        (static_cast<std::uint64_t>(rem) * sum1) % adler_base);
+    sum1 += (adler2 & 0xffff) + adler_base - 1;
+    sum2 += (adler1 >> 16) + (adler2 >> 16) + adler_base - rem;
+    if(sum1 >= adler_base)
+        sum1 -= adler_base;
+    if(sum1 >= adler_base)
+        sum1 -= adler_base;
+    if(sum2 >= (adler_base << 1))
+        sum2 -= (adler_base << 1);
+    if(sum2 >= adler_base)
+        sum2 -= adler_base;
+    return sum1 | (sum2 << 16);
+}
+
+} // detail
+} // http_proto
+} // boost
@@ -0,0 +1,72 @@
+//
+// Copyright (c) 2026 agent (agent@local)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/cppalliance/http_proto
+//
+
+#ifndef BOOST_HTTP_PROTO_DETAIL_CHECKSUM_HPP
+#define BOOST_HTTP_PROTO_DETAIL_CHECKSUM_HPP
+
+#include <boost/http_proto/detail/config.hpp>
+#include <cstddef>
+#include <cstdint>
+
+namespace boost {
+namespace http_proto {
+namespace detail {
+
+// The checksums used by the gzip and zlib
+// formats. These match the zlib functions of
+// the same name, so that independently
+// compressed blocks can be joined.
+
+// Update a CRC-32, starting from 0
+std::uint32_t
+crc32(
+    std::uint32_t crc,
+    void const* data,
+    std::size_t size) noexcept;
+
+// Return the CRC-32 of two concatenated
+// sequences, where len2 is the size of
+// the second sequence.
+std::uint32_t
+crc32_combine(
+    std::uint32_t crc1,
+    std::uint32_t crc2,
+    std::uint64_t len2) noexcept;
+
+// Update an Adler-32, starting from 1
+std::uint32_t
+adler32(
+    std::uint32_t adler,
+    void const* data,
+    std::size_t size) noexcept;
+
+// Return the Adler-32 of two concatenated
+// sequences, where len2 is the size of
+// the second sequence.
+std::uint32_t
+adler32_combine(
+    std::uint32_t adler1,
+    std::uint32_t adler2,
+    std::uint64_t len2) noexcept;
+
+// Update a CRC-32C (Castagnoli), starting
+// from 0. This is the checksum used by iSCSI
+// and by object stores, and uses the SSE4.2
+// instruction when the processor has it.
+std::uint32_t
+crc32c(
+    std::uint32_t crc,
+    void const* data,
+    std::size_t size) noexcept;
+
+} // detail
+} // http_proto
+} // boost
+
+#endif
@@ -0,0 +1,109 @@
+//
+// Copyright (c) 2026 agent (agent@local)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/cppalliance/http_proto
+//
+
+#ifndef BOOST_HTTP_PROTO_DETAIL_CPU_HPP
+#define BOOST_HTTP_PROTO_DETAIL_CPU_HPP
+
+#include <boost/http_proto/detail/config.hpp>
+
+// Instruction set extensions are used by
+// functions compiled for them, and chosen
+// at runtime, so that the library itself
+// is built for the baseline x86-64 target.
+
+#if ! defined(BOOST_HTTP_PROTO_USE_X86_INTRINSICS)
+# if defined(__x86_64__) && \
+    (defined(__GNUC__) || defined(__clang__))
+#  define BOOST_HTTP_PROTO_USE_X86_INTRINSICS 1
+# elif defined(_M_X64) && defined(_MSC_VER)
+#  define BOOST_HTTP_PROTO_USE_X86_INTRINSICS 1
+# endif
+#endif
+
+#if ! defined(BOOST_HTTP_PROTO_USE_X86_INTRINSICS)
+# define BOOST_HTTP_PROTO_USE_X86_INTRINSICS 0
+#endif
+
+#if BOOST_HTTP_PROTO_USE_X86_INTRINSICS
+
+#if defined(_MSC_VER) && ! defined(__clang__)
+# include <intrin.h>
+# define BOOST_HTTP_PROTO_TARGET(isa)
+#else
+# include <cpuid.h>
+# define BOOST_HTTP_PROTO_TARGET(isa) \
+    __attribute__((target(isa)))
+#endif
+#include <immintrin.h>
+
+namespace boost {
+namespace http_proto {
+namespace detail {
+
+struct cpu_features
+{
+    bool sse42 = false;
+    bool sha = false;
+
+    cpu_features() noexcept
+    {
+        unsigned r[4] = {}; // eax, ebx, ecx, edx
+        cpuid(r, 0);
+        auto const max_leaf = r[0];
+        if(max_leaf < 1)
+            return;
+
+        cpuid(r, 1);
+        bool const ssse3 = (r[2] & (1u << 9)) != 0;
+        bool const sse41 = (r[2] & (1u << 19)) != 0;
+        sse42 = (r[2] & (1u << 20)) != 0;
+        if(max_leaf < 7)
+            return;
+
+        // the SHA extensions are used
+        // along with SSSE3 and SSE4.1
+        cpuid(r, 7);
+        sha = ssse3 && sse41 &&
+            (r[1] & (1u << 29)) != 0;
+    }
+
+private:
+    static
+    void
+    cpuid(
+        unsigned* r,
+        unsigned leaf) noexcept
+    {
+#if defined(_MSC_VER) && ! defined(__clang__)
+        int v[4];
+        __cpuidex(v, static_cast<int>(leaf), 0);
+        for(int i = 0; i < 4; ++i)
+            r[i] = static_cast<unsigned>(v[i]);
+#else
+        __cpuid_count(leaf, 0, r[0], r[1], r[2], r[3]);
+#endif
+    }
+};
+
+// Return the features of the running processor
+inline
+cpu_features const&
+get_cpu_features() noexcept
+{
+    static cpu_features const f;
+    return f;
+}
+
+} // detail
+} // http_proto
+} // boost
+
+#endif
+
+#endif
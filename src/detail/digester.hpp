@@ -0,0 +1,104 @@
+//
+// Copyright (c) 2026 agent (agent@local)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/cppalliance/http_proto
+//
+
+#ifndef BOOST_HTTP_PROTO_DETAIL_DIGESTER_HPP
+#define BOOST_HTTP_PROTO_DETAIL_DIGESTER_HPP
+
+#include <boost/http_proto/detail/config.hpp>
+#include <boost/http_proto/digest.hpp>
+#include <boost/buffers/const_buffer.hpp>
+#include "checksum.hpp"
+#include "sha256.hpp"
+#include <cstddef>
+#include <cstdint>
+
+namespace boost {
+namespace http_proto {
+namespace detail {
+
+// Computes the digest of a body
+// from the bytes as they pass.
+class digester
+{
+public:
+    explicit
+    digester(digest_algorithm alg) noexcept
+        : alg_(alg)
+    {
+    }
+
+    void
+    update(
+        void const* data,
+        std::size_t size) noexcept
+    {
+        if(alg_ == digest_algorithm::crc32c)
+            crc_ = crc32c(crc_, data, size);
+        else
+            sha_.update(data, size);
+    }
+
+    // Hash n bytes of a buffer sequence,
+    // after skipping the first `skip`
+    template<class Buffers>
+    void
+    update_buffers(
+        Buffers const& bs,
+        std::size_t n,
+        std::size_t skip = 0) noexcept
+    {
+        for(buffers::const_buffer b : bs)
+        {
+            if(n == 0)
+                break;
+            if(skip >= b.size())
+            {
+                skip -= b.size();
+                continue;
+            }
+            b += skip;
+            skip = 0;
+            auto const m =
+                b.size() < n ? b.size() : n;
+            update(b.data(), m);
+            n -= m;
+        }
+    }
+
+    // Return the digest of the
+    // bytes hashed so far
+    digest
+    result() const noexcept
+    {
+        unsigned char v[digest::max_size];
+        if(alg_ == digest_algorithm::crc32c)
+        {
+            v[0] = static_cast<unsigned char>(crc_ >> 24);
+            v[1] = static_cast<unsigned char>(crc_ >> 16);
+            v[2] = static_cast<unsigned char>(crc_ >> 8);
+            v[3] = static_cast<unsigned char>(crc_);
+        }
+        else
+        {
+            sha_.finish(v);
+        }
+        return digest(alg_, v);
+    }
+
+private:
+    digest_algorithm alg_;
+    std::uint32_t crc_ = 0;
+    sha256 sha_;
+};
+
+} // detail
+} // http_proto
+} // boost
+
+#endif
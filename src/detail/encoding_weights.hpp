@@ -0,0 +1,56 @@
+//
+// Copyright (c) 2026 agent (agent@local)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/cppalliance/http_proto
+//
+
+#ifndef BOOST_HTTP_PROTO_DETAIL_ENCODING_WEIGHTS_HPP
+#define BOOST_HTTP_PROTO_DETAIL_ENCODING_WEIGHTS_HPP
+
+#include <boost/http_proto/detail/config.hpp>
+#include <boost/http_proto/metadata.hpp>
+#include <boost/core/detail/string_view.hpp>
+
+namespace boost {
+namespace http_proto {
+namespace detail {
+
+// The qvalues, scaled to [0, 1000], which
+// Accept-Encoding values give to each coding.
+struct encoding_weights
+{
+    static constexpr int size =
+        static_cast<int>(encoding::zstd) + 1;
+
+    // -1 means the coding is not listed
+    short q[size] = { -1, -1, -1, -1, -1, -1 };
+    short any = -1; // "*"
+
+    // Add the codings of one field value.
+    // Malformed values are ignored.
+    BOOST_HTTP_PROTO_DECL
+    void
+    add(core::string_view value) noexcept;
+
+    // Return the effective qvalue of a coding
+    unsigned
+    get(encoding e) const noexcept
+    {
+        auto const v = q[static_cast<int>(e)];
+        if(v >= 0)
+            return static_cast<unsigned>(v);
+        if(any >= 0)
+            return static_cast<unsigned>(any);
+        // identity is acceptable unless excluded
+        return e == encoding::identity ? 1000 : 0;
+    }
+};
+
+} // detail
+} // http_proto
+} // boost
+
+#endif
@@ -695,6 +695,18 @@ on_insert_content_encoding(
         md.content_encoding.encoding =
             encoding::gzip;
     }
+    else if( grammar::ci_is_equal(*(rv->begin()),
+        "br") )
+    {
+        md.content_encoding.encoding =
+            encoding::br;
+    }
+    else if( grammar::ci_is_equal(*(rv->begin()),
+        "zstd") )
+    {
+        md.content_encoding.encoding =
+            encoding::zstd;
+    }
     else
     {
         md.content_encoding.encoding =
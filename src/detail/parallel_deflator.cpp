@@ -0,0 +1,367 @@
+//
+// Copyright (c) 2026 agent (agent@local)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/cppalliance/http_proto
+//
+
+#include "parallel_deflator.hpp"
+#include "checksum.hpp"
+
+#include <boost/http_proto/detail/except.hpp>
+#include <boost/assert.hpp>
+#include <boost/buffers/algorithm.hpp>
+#include <cstring>
+
+namespace boost {
+namespace http_proto {
+namespace detail {
+
+namespace {
+
+// the compression level of each block
+constexpr int block_level = -1;
+
+// upper bound on the raw deflate output for n
+// bytes of input, including the sync flush
+std::size_t
+deflate_bound(std::size_t n) noexcept
+{
+    return n + (n >> 12) + (n >> 14) + (n >> 25) + 64;
+}
+
+} // (anon)
+
+struct parallel_deflator::slot
+    : worker_pool::work
+{
+    parallel_deflator& self;
+    workspace ws;
+    std::unique_ptr<unsigned char[]> in;
+    std::unique_ptr<unsigned char[]> out;
+    std::size_t in_size = 0;
+    std::size_t out_size = 0;
+    std::size_t out_pos = 0;
+    bool done = false;
+    system::error_code ec;
+    std::uint32_t check = 0;
+
+    slot(
+        parallel_deflator& self_,
+        std::size_t ws_size)
+        : self(self_)
+        , ws(ws_size)
+        , in(new unsigned char[self_.block_size_])
+        , out(new unsigned char[self_.out_size_])
+    {
+    }
+
+    void
+    run() noexcept override
+    {
+        self.compress(*this, true);
+    }
+};
+
+parallel_deflator::
+parallel_deflator(
+    context& ctx,
+    bool use_gzip,
+    std::size_t block_size,
+    std::size_t max_blocks)
+    : svc_(ctx.get_service<zlib::service>())
+    , pool_(ctx.find_service<worker_pool>())
+    , use_gzip_(use_gzip)
+    , block_size_(block_size)
+    , out_size_(deflate_bound(block_size))
+    , n_(max_blocks)
+    , check_(use_gzip ? 0 : 1)
+{
+    if(block_size_ == 0)
+        detail::throw_invalid_argument();
+
+    if(n_ == 0)
+        n_ = pool_ ? pool_->concurrency() + 1 : 1;
+
+    // one byte more, since the last
+    // byte can never be reserved
+    auto const ws_size =
+        svc_.deflator_space_needed(15, 8) + 1;
+    slots_.reset(new std::unique_ptr<slot>[n_]);
+    for(std::size_t i = 0; i < n_; ++i)
+        slots_[i].reset(new slot(*this, ws_size));
+
+    if(use_gzip_)
+    {
+        // ID1 ID2 CM FLG MTIME(4) XFL OS
+        static unsigned char const h[] = {
+            0x1f, 0x8b, 0x08, 0x00,
+            0x00, 0x00, 0x00, 0x00,
+            0x00, 0xff };
+        std::memcpy(extra_, h, sizeof(h));
+        extra_len_ = sizeof(h);
+    }
+    else
+    {
+        // CMF FLG, 32K window and default level
+        extra_[0] = 0x78;
+        extra_[1] = 0x9c;
+        extra_len_ = 2;
+    }
+}
+
+parallel_deflator::
+~parallel_deflator()
+{
+    // submitted blocks refer to the slots
+    std::unique_lock<std::mutex> lock(m_);
+    cv_.wait(lock, [this]{ return busy_ == 0; });
+}
+
+void
+parallel_deflator::
+submit(slot& s)
+{
+    ++pending_;
+    {
+        std::lock_guard<std::mutex> lock(m_);
+        s.done = false;
+    }
+    if(! pool_)
+    {
+        compress(s, false);
+        return;
+    }
+    {
+        std::lock_guard<std::mutex> lock(m_);
+        ++busy_;
+    }
+    try
+    {
+        pool_->post(s);
+    }
+    catch(...)
+    {
+        // fall back to this thread
+        {
+            std::lock_guard<std::mutex> lock(m_);
+            --busy_;
+        }
+        compress(s, false);
+    }
+}
+
+void
+parallel_deflator::
+compress(
+    slot& s,
+    bool pooled) noexcept
+{
+    system::error_code ec;
+    std::size_t n = 0;
+    try
+    {
+        s.ws.clear();
+        auto& z = svc_.make_deflator(
+            s.ws, block_level, -15, 8);
+        zlib::params p{
+            s.in.get(), s.in_size,
+            s.out.get(), out_size_ };
+        ec = z.write(p, zlib::flush::sync);
+        if(! ec.failed() && p.avail_in != 0)
+            ec = zlib::error::buf_err;
+        n = out_size_ - p.avail_out;
+    }
+    catch(system::system_error const& e)
+    {
+        ec = e.code();
+    }
+    catch(...)
+    {
+        ec = zlib::error::mem_err;
+    }
+
+    std::uint32_t const check = use_gzip_ ?
+        detail::crc32(0, s.in.get(), s.in_size) :
+        detail::adler32(1, s.in.get(), s.in_size);
+
+    std::lock_guard<std::mutex> lock(m_);
+    s.ec = ec;
+    s.out_size = n;
+    s.out_pos = 0;
+    s.check = check;
+    s.done = true;
+    if(pooled)
+        --busy_;
+    cv_.notify_all();
+}
+
+bool
+parallel_deflator::
+wait(slot& s, bool block)
+{
+    std::unique_lock<std::mutex> lock(m_);
+    if(block)
+        cv_.wait(lock, [&s]{
+            return s.done; });
+    return s.done;
+}
+
+void
+parallel_deflator::
+write_trailer() noexcept
+{
+    // empty final stored block
+    extra_[0] = 0x03;
+    extra_[1] = 0x00;
+    if(use_gzip_)
+    {
+        // CRC32 ISIZE, little endian
+        auto const size =
+            static_cast<std::uint32_t>(total_);
+        for(int i = 0; i < 4; ++i)
+        {
+            extra_[2 + i] = static_cast<
+                unsigned char>(check_ >> (8 * i));
+            extra_[6 + i] = static_cast<
+                unsigned char>(size >> (8 * i));
+        }
+        extra_len_ = 10;
+    }
+    else
+    {
+        // ADLER32, big endian
+        for(int i = 0; i < 4; ++i)
+            extra_[2 + i] = static_cast<
+                unsigned char>(check_ >> (24 - 8 * i));
+        extra_len_ = 6;
+    }
+    extra_pos_ = 0;
+    trailer_ = true;
+}
+
+filter::results
+parallel_deflator::
+on_process(
+    buffers::mutable_buffer out,
+    buffers::const_buffer in,
+    bool more)
+{
+    results rs;
+    auto const emit = [&](
+        unsigned char const* p,
+        std::size_t n)
+    {
+        if(n > out.size())
+            n = out.size();
+        std::memcpy(out.data(), p, n);
+        out = buffers::suffix(out, out.size() - n);
+        rs.out_bytes += n;
+        return n;
+    };
+
+    for(;;)
+    {
+        // header or trailer
+        if(extra_pos_ < extra_len_)
+        {
+            extra_pos_ += emit(
+                extra_ + extra_pos_,
+                extra_len_ - extra_pos_);
+            if(extra_pos_ < extra_len_)
+                return rs;
+        }
+        if(trailer_)
+        {
+            rs.finished = true;
+            return rs;
+        }
+
+        // oldest block, in order
+        auto& h = *slots_[head_];
+        if( pending_ > 0 &&
+            wait(h, false))
+        {
+            if(h.ec.failed())
+            {
+                rs.ec = h.ec;
+                return rs;
+            }
+            h.out_pos += emit(
+                h.out.get() + h.out_pos,
+                h.out_size - h.out_pos);
+            if(h.out_pos < h.out_size)
+                return rs;
+            check_ = use_gzip_ ?
+                detail::crc32_combine(
+                    check_, h.check, h.in_size) :
+                detail::adler32_combine(
+                    check_, h.check, h.in_size);
+            total_ += h.in_size;
+            h.in_size = 0;
+            head_ = (head_ + 1) % n_;
+            --pending_;
+            continue;
+        }
+
+        if(out.size() == 0)
+            return rs;
+
+        // fill the block after the pending ones
+        auto& f = *slots_[(head_ + pending_) % n_];
+        if( in.size() > 0 &&
+            pending_ < n_)
+        {
+            auto n = block_size_ - f.in_size;
+            if(n > in.size())
+                n = in.size();
+            std::memcpy(
+                f.in.get() + f.in_size, in.data(), n);
+            in = buffers::suffix(in, in.size() - n);
+            rs.in_bytes += n;
+            f.in_size += n;
+            if(f.in_size == block_size_)
+                submit(f);
+            continue;
+        }
+
+        if( ! more &&
+            in.size() == 0 &&
+            ! input_done_)
+        {
+            input_done_ = true;
+            if( pending_ < n_ &&
+                f.in_size > 0)
+                submit(f);
+            continue;
+        }
+
+        if(input_done_)
+        {
+            if(pending_ == 0)
+            {
+                write_trailer();
+                continue;
+            }
+        }
+        else if(
+            in.size() == 0 ||
+            rs.in_bytes > 0 ||
+            rs.out_bytes > 0)
+        {
+            // the caller can provide more input
+            // or make use of the output
+            return rs;
+        }
+
+        // nothing to do until the
+        // oldest block is finished
+        wait(h, true);
+    }
+}
+
+} // detail
+} // http_proto
+} // boost
@@ -0,0 +1,100 @@
+//
+// Copyright (c) 2026 agent (agent@local)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/cppalliance/http_proto
+//
+
+#ifndef BOOST_HTTP_PROTO_DETAIL_PARALLEL_DEFLATOR_HPP
+#define BOOST_HTTP_PROTO_DETAIL_PARALLEL_DEFLATOR_HPP
+
+#include <boost/http_proto/context.hpp>
+#include <boost/http_proto/detail/config.hpp>
+#include <boost/http_proto/detail/workspace.hpp>
+#include <boost/http_proto/service/worker_pool.hpp>
+#include <boost/http_proto/service/zlib_service.hpp>
+
+#include "filter.hpp"
+
+#include <condition_variable>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+
+namespace boost {
+namespace http_proto {
+namespace detail {
+
+/** A deflate or gzip filter which compresses blocks in parallel
+
+    The input is split into blocks which are
+    compressed independently on the context's
+    @ref worker_pool, each ending on a sync flush
+    boundary so that the compressed blocks can be
+    concatenated. The output is emitted in order,
+    followed by an empty final block and the
+    checksum of the whole input, combined from
+    the checksums of the blocks.
+
+    Without a worker pool, blocks are compressed
+    on the calling thread.
+*/
+class parallel_deflator
+    : public filter
+{
+public:
+    parallel_deflator(
+        context& ctx,
+        bool use_gzip,
+        std::size_t block_size,
+        std::size_t max_blocks);
+
+    ~parallel_deflator();
+
+private:
+    struct slot;
+
+    results
+    on_process(
+        buffers::mutable_buffer out,
+        buffers::const_buffer in,
+        bool more) override;
+
+    void submit(slot& s);
+    void compress(slot& s, bool pooled) noexcept;
+    bool wait(slot& s, bool block);
+    void write_trailer() noexcept;
+
+    zlib::service const& svc_;
+    worker_pool* pool_;
+    bool use_gzip_;
+    std::size_t block_size_;
+    std::size_t out_size_;
+    std::size_t n_;
+    std::unique_ptr<std::unique_ptr<slot>[]> slots_;
+
+    std::size_t head_ = 0;    // oldest submitted
+    std::size_t pending_ = 0; // submitted, not emitted
+    bool input_done_ = false;
+
+    std::uint32_t check_;
+    std::uint64_t total_ = 0;
+
+    // header or trailer octets
+    unsigned char extra_[18];
+    std::size_t extra_pos_ = 0;
+    std::size_t extra_len_ = 0;
+    bool trailer_ = false;
+
+    std::mutex m_;
+    std::condition_variable cv_;
+    std::size_t busy_ = 0; // posted to the pool
+};
+
+} // detail
+} // http_proto
+} // boost
+
+#endif
@@ -0,0 +1,286 @@
+//
+// Copyright (c) 2026 agent (agent@local)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/cppalliance/http_proto
+//
+
+#include "sha256.hpp"
+#include "cpu.hpp"
+#include <cstring>
+
+namespace boost {
+namespace http_proto {
+namespace detail {
+
+namespace {
+
+alignas(16)
+constexpr std::uint32_t k256[64] = {
+    0x428a2f98, 0x71374491, 0xb5c0fbcf, 0xe9b5dba5,
+    0x3956c25b, 0x59f111f1, 0x923f82a4, 0xab1c5ed5,
+    0xd807aa98, 0x12835b01, 0x243185be, 0x550c7dc3,
+    0x72be5d74, 0x80deb1fe, 0x9bdc06a7, 0xc19bf174,
+    0xe49b69c1, 0xefbe4786, 0x0fc19dc6, 0x240ca1cc,
+    0x2de92c6f, 0x4a7484aa, 0x5cb0a9dc, 0x76f988da,
+    0x983e5152, 0xa831c66d, 0xb00327c8, 0xbf597fc7,
+    0xc6e00bf3, 0xd5a79147, 0x06ca6351, 0x14292967,
+    0x27b70a85, 0x2e1b2138, 0x4d2c6dfc, 0x53380d13,
+    0x650a7354, 0x766a0abb, 0x81c2c92e, 0x92722c85,
+    0xa2bfe8a1, 0xa81a664b, 0xc24b8b70, 0xc76c51a3,
+    0xd192e819, 0xd6990624, 0xf40e3585, 0x106aa070,
+    0x19a4c116, 0x1e376c08, 0x2748774c, 0x34b0bcb5,
+    0x391c0cb3, 0x4ed8aa4a, 0x5b9cca4f, 0x682e6ff3,
+    0x748f82ee, 0x78a5636f, 0x84c87814, 0x8cc70208,
+    0x90befffa, 0xa4506ceb, 0xbef9a3f7, 0xc67178f2
+};
+
+inline
+std::uint32_t
+rotr(std::uint32_t x, int n) noexcept
+{
+    return (x >> n) | (x << (32 - n));
+}
+
+inline
+std::uint32_t
+load_be32(unsigned char const* p) noexcept
+{
+    return
+        (std::uint32_t(p[0]) << 24) |
+        (std::uint32_t(p[1]) << 16) |
+        (std::uint32_t(p[2]) <<  8) |
+         std::uint32_t(p[3]);
+}
+
+inline
+void
+store_be32(
+    unsigned char* p,
+    std::uint32_t v) noexcept
+{
+    p[0] = static_cast<unsigned char>(v >> 24);
+    p[1] = static_cast<unsigned char>(v >> 16);
+    p[2] = static_cast<unsigned char>(v >>  8);
+    p[3] = static_cast<unsigned char>(v);
+}
+
+void
+compress_generic(
+    std::uint32_t* h,
+    unsigned char const* p,
+    std::size_t blocks) noexcept
+{
+    std::uint32_t w[64];
+    while(blocks--)
+    {
+        for(int i = 0; i < 16; ++i)
+            w[i] = load_be32(p + 4 * i);
+        for(int i = 16; i < 64; ++i)
+        {
+            auto const s0 = rotr(w[i - 15], 7) ^
+                rotr(w[i - 15], 18) ^ (w[i - 15] >> 3);
+            auto const s1 = rotr(w[i - 2], 17) ^
+                rotr(w[i - 2], 19) ^ (w[i - 2] >> 10);
+            w[i] = w[i - 16] + s0 + w[i - 7] + s1;
+        }
+
+        auto a = h[0], b = h[1], c = h[2], d = h[3];
+        auto e = h[4], f = h[5], g = h[6], hh = h[7];
+        for(int i = 0; i < 64; ++i)
+        {
+            auto const S1 =
+                rotr(e, 6) ^ rotr(e, 11) ^ rotr(e, 25);
+            auto const ch = (e & f) ^ (~e & g);
+            auto const t1 = hh + S1 + ch + k256[i] + w[i];
+            auto const S0 =
+                rotr(a, 2) ^ rotr(a, 13) ^ rotr(a, 22);
+            auto const maj = (a & b) ^ (a & c) ^ (b & c);
+            auto const t2 = S0 + maj;
+            hh = g;
+            g = f;
+            f = e;
+            e = d + t1;
+            d = c;
+            c = b;
+            b = a;
+            a = t1 + t2;
+        }
+        h[0] += a; h[1] += b; h[2] += c; h[3] += d;
+        h[4] += e; h[5] += f; h[6] += g; h[7] += hh;
+        p += 64;
+    }
+}
+
+#if BOOST_HTTP_PROTO_USE_X86_INTRINSICS
+
+// The SHA extensions keep the state as the
+// pairs ABEF and CDGH, and perform two rounds
+// per instruction. Each group of four rounds
+// also extends the message schedule by four
+// words, which are kept in a ring of four.
+BOOST_HTTP_PROTO_TARGET("sha,sse4.1,ssse3")
+void
+compress_sha_ni(
+    std::uint32_t* h,
+    unsigned char const* p,
+    std::size_t blocks) noexcept
+{
+    __m128i const mask = _mm_set_epi64x(
+        0x0c0d0e0f08090a0bULL, 0x0405060700010203ULL);
+
+    // DCBA, HGFE to ABEF, CDGH
+    __m128i t = _mm_loadu_si128(
+        reinterpret_cast<__m128i const*>(&h[0]));
+    __m128i s1 = _mm_loadu_si128(
+        reinterpret_cast<__m128i const*>(&h[4]));
+    t = _mm_shuffle_epi32(t, 0xb1);
+    s1 = _mm_shuffle_epi32(s1, 0x1b);
+    __m128i s0 = _mm_alignr_epi8(t, s1, 8);
+    s1 = _mm_blend_epi16(s1, t, 0xf0);
+
+    while(blocks--)
+    {
+        __m128i const abef = s0;
+        __m128i const cdgh = s1;
+        __m128i w[4];
+        for(int i = 0; i < 16; ++i)
+        {
+            auto& wi = w[i & 3];
+            if(i < 4)
+            {
+                wi = _mm_shuffle_epi8(
+                    _mm_loadu_si128(
+                        reinterpret_cast<
+                            __m128i const*>(p + 16 * i)),
+                    mask);
+            }
+            else
+            {
+                auto const& w1 = w[(i + 1) & 3];
+                auto const& w2 = w[(i + 2) & 3];
+                auto const& w3 = w[(i + 3) & 3];
+                wi = _mm_sha256msg2_epu32(
+                    _mm_add_epi32(
+                        _mm_sha256msg1_epu32(wi, w1),
+                        _mm_alignr_epi8(w3, w2, 4)),
+                    w3);
+            }
+            __m128i m = _mm_add_epi32(wi,
+                _mm_load_si128(
+                    reinterpret_cast<
+                        __m128i const*>(&k256[4 * i])));
+            s1 = _mm_sha256rnds2_epu32(s1, s0, m);
+            m = _mm_shuffle_epi32(m, 0x0e);
+            s0 = _mm_sha256rnds2_epu32(s0, s1, m);
+        }
+        s0 = _mm_add_epi32(s0, abef);
+        s1 = _mm_add_epi32(s1, cdgh);
+        p += 64;
+    }
+
+    // ABEF, CDGH to DCBA, HGFE
+    t = _mm_shuffle_epi32(s0, 0x1b);
+    s1 = _mm_shuffle_epi32(s1, 0xb1);
+    s0 = _mm_blend_epi16(t, s1, 0xf0);
+    s1 = _mm_alignr_epi8(s1, t, 8);
+    _mm_storeu_si128(
+        reinterpret_cast<__m128i*>(&h[0]), s0);
+    _mm_storeu_si128(
+        reinterpret_cast<__m128i*>(&h[4]), s1);
+}
+
+#endif
+
+void
+compress(
+    std::uint32_t* h,
+    unsigned char const* p,
+    std::size_t blocks) noexcept
+{
+#if BOOST_HTTP_PROTO_USE_X86_INTRINSICS
+    if(get_cpu_features().sha)
+        return compress_sha_ni(h, p, blocks);
+#endif
+    compress_generic(h, p, blocks);
+}
+
+} // (anon)
+
+sha256::
+sha256() noexcept
+    : h_{
+        0x6a09e667, 0xbb67ae85, 0x3c6ef372, 0xa54ff53a,
+        0x510e527f, 0x9b05688c, 0x1f83d9ab, 0x5be0cd19 }
+{
+}
+
+void
+sha256::
+update(
+    void const* data,
+    std::size_t size) noexcept
+{
+    auto p = static_cast<
+        unsigned char const*>(data);
+    auto used = static_cast<
+        std::size_t>(size_ % block_size);
+    size_ += size;
+
+    // complete a partial block
+    if(used > 0)
+    {
+        auto n = block_size - used;
+        if(n > size)
+            n = size;
+        std::memcpy(buf_ + used, p, n);
+        p += n;
+        size -= n;
+        if(used + n < block_size)
+            return;
+        compress(h_, buf_, 1);
+    }
+
+    // whole blocks are compressed in place
+    auto const blocks = size / block_size;
+    if(blocks > 0)
+    {
+        compress(h_, p, blocks);
+        p += blocks * block_size;
+        size -= blocks * block_size;
+    }
+    if(size > 0)
+        std::memcpy(buf_, p, size);
+}
+
+void
+sha256::
+finish(unsigned char* dest) const noexcept
+{
+    // pad a copy, leaving this unchanged
+    std::uint32_t h[8];
+    std::memcpy(h, h_, sizeof(h));
+    unsigned char b[2 * block_size] = {};
+    auto const used = static_cast<
+        std::size_t>(size_ % block_size);
+    std::memcpy(b, buf_, used);
+    b[used] = 0x80;
+    std::size_t const n =
+        (used < block_size - 8) ? 1 : 2;
+    auto const bits = size_ * 8;
+    auto* end = b + n * block_size;
+    store_be32(end - 8,
+        static_cast<std::uint32_t>(bits >> 32));
+    store_be32(end - 4,
+        static_cast<std::uint32_t>(bits));
+    compress(h, b, n);
+
+    for(int i = 0; i < 8; ++i)
+        store_be32(dest + 4 * i, h[i]);
+}
+
+} // detail
+} // http_proto
+} // boost
@@ -0,0 +1,54 @@
+//
+// Copyright (c) 2026 agent (agent@local)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/cppalliance/http_proto
+//
+
+#ifndef BOOST_HTTP_PROTO_DETAIL_SHA256_HPP
+#define BOOST_HTTP_PROTO_DETAIL_SHA256_HPP
+
+#include <boost/http_proto/detail/config.hpp>
+#include <cstddef>
+#include <cstdint>
+
+namespace boost {
+namespace http_proto {
+namespace detail {
+
+// An incremental SHA-256, as specified in
+// FIPS 180-4. Blocks are compressed with the
+// SHA extensions when the processor has them.
+class sha256
+{
+public:
+    static constexpr std::size_t digest_size = 32;
+
+    sha256() noexcept;
+
+    void
+    update(
+        void const* data,
+        std::size_t size) noexcept;
+
+    // Write the digest of the data so far.
+    // The state is left unchanged, so more
+    // data may be added afterwards.
+    void
+    finish(unsigned char* dest) const noexcept;
+
+private:
+    static constexpr std::size_t block_size = 64;
+
+    std::uint32_t h_[8];
+    std::uint64_t size_ = 0;
+    unsigned char buf_[block_size];
+};
+
+} // detail
+} // http_proto
+} // boost
+
+#endif
@@ -0,0 +1,178 @@
+//
+// Copyright (c) 2026 agent (agent@local)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/cppalliance/http_proto
+//
+
+#include "spsc_ring.hpp"
+#include <boost/http_proto/detail/except.hpp>
+#include <boost/http_proto/error.hpp>
+
+namespace boost {
+namespace http_proto {
+namespace detail {
+
+constexpr std::size_t spsc_ring::line;
+
+spsc_ring::
+spsc_ring() noexcept
+    : head_(0)
+    , closed_(false)
+    , producer_waiting_(false)
+    , tail_(0)
+    , consumer_waiting_(false)
+{
+}
+
+void
+spsc_ring::
+reset(
+    unsigned char* base,
+    std::size_t size) noexcept
+{
+    base_ = base;
+    cap_ = size;
+}
+
+auto
+spsc_ring::
+prepare() noexcept ->
+    buffers::mutable_buffer_pair
+{
+    auto const h = head_.load(
+        std::memory_order_relaxed);
+    auto t = tail_.load(
+        std::memory_order_acquire);
+    if( h - t == cap_ )
+    {
+        // the consumer notifies
+        // after freeing space
+        producer_waiting_.store(true);
+        t = tail_.load();
+        if( h - t == cap_ )
+            return {};
+        producer_waiting_.store(
+            false, std::memory_order_relaxed);
+    }
+
+    auto const pos =
+        static_cast<std::size_t>(h % cap_);
+    auto const free =
+        cap_ - static_cast<std::size_t>(h - t);
+    auto n = cap_ - pos;
+    if( n > free )
+        n = free;
+
+    buffers::mutable_buffer_pair mbp;
+    mbp[0] = { base_ + pos, n };
+    mbp[1] = { base_, free - n };
+    return mbp;
+}
+
+void
+spsc_ring::
+commit(std::size_t n)
+{
+    // the stream must make a non-zero amount of bytes
+    // available to the serializer
+    if( n == 0 )
+        detail::throw_logic_error();
+
+    auto const h = head_.load(
+        std::memory_order_relaxed);
+    auto const t = tail_.load(
+        std::memory_order_acquire);
+    if( n > cap_ - static_cast<
+            std::size_t>(h - t) )
+        detail::throw_invalid_argument();
+
+    head_.store(h + n);
+    notify_consumer();
+}
+
+void
+spsc_ring::
+close()
+{
+    // Precondition violation
+    if( closed_.load(
+            std::memory_order_relaxed) )
+        detail::throw_logic_error();
+
+    closed_.store(true);
+    notify_consumer();
+}
+
+void
+spsc_ring::
+notify_consumer() noexcept
+{
+    if( consumer_waiting_.load() &&
+        consumer_waiting_.exchange(false) &&
+        h_ )
+        h_->on_data();
+}
+
+auto
+spsc_ring::
+on_prepare() ->
+    results
+{
+    results rv;
+    auto const t = tail_.load(
+        std::memory_order_relaxed);
+
+    // closed is read first, so that
+    // the head is final once it is set
+    auto c = closed_.load(
+        std::memory_order_acquire);
+    auto h = head_.load(
+        std::memory_order_acquire);
+    if( h == t && !c )
+    {
+        // the producer notifies
+        // after its next change
+        consumer_waiting_.store(true);
+        c = closed_.load();
+        h = head_.load();
+        if( h == t && !c )
+        {
+            rv.ec = BOOST_HTTP_PROTO_ERR(
+                error::would_block);
+            return rv;
+        }
+        consumer_waiting_.store(
+            false, std::memory_order_relaxed);
+    }
+
+    auto const pos =
+        static_cast<std::size_t>(t % cap_);
+    auto n = static_cast<
+        std::size_t>(h - t);
+    if( n > cap_ - pos )
+        n = cap_ - pos;
+    rv.data = { base_ + pos, n };
+    rv.finished = c && t + n == h;
+    return rv;
+}
+
+void
+spsc_ring::
+on_consume(std::size_t n) noexcept
+{
+    if( n == 0 )
+        return;
+    tail_.store(tail_.load(
+        std::memory_order_relaxed) + n);
+    if( producer_waiting_.load() &&
+        producer_waiting_.exchange(false) &&
+        h_ )
+        h_->on_space();
+}
+
+} // detail
+} // http_proto
+} // boost
@@ -0,0 +1,99 @@
+//
+// Copyright (c) 2026 agent (agent@local)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/cppalliance/http_proto
+//
+
+#ifndef BOOST_HTTP_PROTO_DETAIL_SPSC_RING_HPP
+#define BOOST_HTTP_PROTO_DETAIL_SPSC_RING_HPP
+
+#include <boost/http_proto/detail/config.hpp>
+#include <boost/http_proto/serializer.hpp>
+#include <boost/http_proto/view_source.hpp>
+#include <boost/buffers/mutable_buffer_pair.hpp>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+namespace boost {
+namespace http_proto {
+namespace detail {
+
+// A single-producer, single-consumer ring
+// of bytes. The producer writes with prepare
+// and commit, and the serializer reads it
+// as a view source.
+//
+// Each side which finds nothing to do sets
+// its waiting flag and checks again, and the
+// other side clears the flag and invokes the
+// handler after its next change, so neither
+// side polls and no wakeup is lost.
+class spsc_ring
+    : public view_source
+{
+public:
+    using handler =
+        serializer::shared_stream::handler;
+
+    spsc_ring() noexcept;
+
+    void
+    reset(
+        unsigned char* base,
+        std::size_t size) noexcept;
+
+    void
+    set_handler(handler* h) noexcept
+    {
+        h_ = h;
+    }
+
+    // producer
+    buffers::mutable_buffer_pair
+    prepare() noexcept;
+
+    void
+    commit(std::size_t n);
+
+    void
+    close();
+
+private:
+    // consumer
+    results
+    on_prepare() override;
+
+    void
+    on_consume(std::size_t n) noexcept override;
+
+    void notify_consumer() noexcept;
+
+    // keeps the fields written by each
+    // side on separate cache lines
+    static constexpr std::size_t line = 64;
+
+    unsigned char* base_ = nullptr;
+    std::size_t cap_ = 0;
+    handler* h_ = nullptr;
+
+    // written by the producer
+    std::atomic<std::uint64_t> head_;
+    std::atomic<bool> closed_;
+    std::atomic<bool> producer_waiting_;
+    char pad0_[line];
+
+    // written by the consumer
+    std::atomic<std::uint64_t> tail_;
+    std::atomic<bool> consumer_waiting_;
+    char pad1_[line];
+};
+
+} // detail
+} // http_proto
+} // boost
+
+#endif
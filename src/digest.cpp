@@ -0,0 +1,134 @@
+//
+// Copyright (c) 2026 agent (agent@local)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/cppalliance/http_proto
+//
+
+#include <boost/http_proto/digest.hpp>
+#include <cstdint>
+#include <cstring>
+
+namespace boost {
+namespace http_proto {
+
+core::string_view
+to_string(digest_algorithm alg) noexcept
+{
+    switch(alg)
+    {
+    case digest_algorithm::crc32c:
+        return "crc32c";
+    case digest_algorithm::sha256:
+        return "sha-256";
+    default:
+    case digest_algorithm::none:
+        break;
+    }
+    return {};
+}
+
+digest::
+digest(
+    digest_algorithm alg,
+    unsigned char const* data) noexcept
+    : alg_(alg)
+    , v_{}
+{
+    std::memcpy(v_, data, size());
+}
+
+std::size_t
+digest::
+size() const noexcept
+{
+    switch(alg_)
+    {
+    case digest_algorithm::crc32c:
+        return 4;
+    case digest_algorithm::sha256:
+        return 32;
+    default:
+    case digest_algorithm::none:
+        break;
+    }
+    return 0;
+}
+
+std::string
+digest::
+to_hex() const
+{
+    static constexpr char digits[] =
+        "0123456789abcdef";
+    std::string s;
+    s.reserve(2 * size());
+    for(std::size_t i = 0; i < size(); ++i)
+    {
+        s.push_back(digits[v_[i] >> 4]);
+        s.push_back(digits[v_[i] & 0xf]);
+    }
+    return s;
+}
+
+std::string
+digest::
+to_field_value() const
+{
+    // sf-binary is base64 between colons
+    static constexpr char alphabet[] =
+        "ABCDEFGHIJKLMNOPQRSTUVWXYZ"
+        "abcdefghijklmnopqrstuvwxyz"
+        "0123456789+/";
+
+    if(empty())
+        return {};
+
+    auto const name = to_string(alg_);
+    auto const n = size();
+    std::string s;
+    s.reserve(name.size() + 3 + 4 * ((n + 2) / 3));
+    s.append(name.data(), name.size());
+    s.append("=:", 2);
+    std::size_t i = 0;
+    for(; i + 3 <= n; i += 3)
+    {
+        std::uint32_t const v =
+            (std::uint32_t(v_[i]) << 16) |
+            (std::uint32_t(v_[i + 1]) << 8) |
+             std::uint32_t(v_[i + 2]);
+        s.push_back(alphabet[(v >> 18) & 0x3f]);
+        s.push_back(alphabet[(v >> 12) & 0x3f]);
+        s.push_back(alphabet[(v >> 6) & 0x3f]);
+        s.push_back(alphabet[v & 0x3f]);
+    }
+    if(i < n)
+    {
+        std::uint32_t v = std::uint32_t(v_[i]) << 16;
+        if(i + 1 < n)
+            v |= std::uint32_t(v_[i + 1]) << 8;
+        s.push_back(alphabet[(v >> 18) & 0x3f]);
+        s.push_back(alphabet[(v >> 12) & 0x3f]);
+        if(i + 1 < n)
+            s.push_back(alphabet[(v >> 6) & 0x3f]);
+        else
+            s.push_back('=');
+        s.push_back('=');
+    }
+    s.push_back(':');
+    return s;
+}
+
+bool
+digest::
+equals(digest const& other) const noexcept
+{
+    return
+        alg_ == other.alg_ &&
+        std::memcmp(v_, other.v_, size()) == 0;
+}
+
+} // http_proto
+} // boost
@@ -45,6 +45,7 @@ message(
     case error::end_of_stream: return "end of stream";
     case error::in_place_overflow: return "in place overflow";
     case error::need_data: return "need data";
+    case error::would_block: return "would block";
 
     case error::bad_connection: return "bad Connection";
     case error::bad_content_length: return "bad Content-Length";
@@ -75,6 +76,7 @@ message(
     case error::numeric_overflow: return "numeric overflow";
     case error::multiple_content_length: return "multiple Content-Length";
     case error::buffer_overflow: return "buffer overflow";
+    case error::not_acceptable: return "not acceptable";
     default:
         return "unknown";
     }
@@ -8,12 +8,47 @@
 //
 
 #include <boost/http_proto/file_body.hpp>
+#include <boost/http_proto/error.hpp>
+#include <boost/http_proto/message_base.hpp>
+#include <boost/http_proto/rfc/list_rule.hpp>
+#include <boost/http_proto/rfc/token_rule.hpp>
 #include <boost/buffers/algorithm.hpp>
+#include <boost/buffers/buffer_size.hpp>
+#include <boost/url/grammar/ci_string.hpp>
+#include <boost/url/grammar/parse.hpp>
 #include <boost/assert.hpp>
+#include <algorithm>
+#include <cstring>
+#include <string>
+
+#include "detail/encoding_weights.hpp"
+
+// file is file_posix
+#if ! BOOST_HTTP_PROTO_USE_WIN32_FILE && \
+    BOOST_HTTP_PROTO_USE_POSIX_FILE
+# define BOOST_HTTP_PROTO_FILE_IS_POSIX 1
+#else
+# define BOOST_HTTP_PROTO_FILE_IS_POSIX 0
+#endif
 
 namespace boost {
 namespace http_proto {
 
+namespace {
+
+constexpr
+std::size_t
+direct_alignment() noexcept
+{
+#if BOOST_HTTP_PROTO_FILE_IS_POSIX
+    return file::direct_alignment();
+#else
+    return 4096;
+#endif
+}
+
+} // (anon)
+
 file_body::
 ~file_body() = default;
 
@@ -30,12 +65,41 @@ file_body(
 {
 }
 
+void
+file_body::
+set_direct(
+    std::size_t buffer_size,
+    system::error_code& ec)
+{
+#if BOOST_HTTP_PROTO_FILE_IS_POSIX
+    BOOST_ASSERT(! dinit_);
+    f_.set_direct(true, ec);
+    if(ec.failed())
+        return;
+    auto const a = direct_alignment();
+    if(buffer_size < a)
+        buffer_size = a;
+    dsize_ = (buffer_size + a - 1) & ~(a - 1);
+    dbuf_.reset(new unsigned char[dsize_ + a - 1]);
+    auto const u = reinterpret_cast<
+        std::uintptr_t>(dbuf_.get());
+    dp_ = dbuf_.get() + (
+        ((u + a - 1) & ~std::uintptr_t(a - 1)) - u);
+#else
+    (void)buffer_size;
+    ec = make_error_code(
+        system::errc::operation_not_supported);
+#endif
+}
+
 auto
 file_body::
 on_read(
     buffers::mutable_buffer b) ->
         source::results
 {
+    if(dp_)
+        return read_direct(b);
     source::results rv;
     if(n_ > 0)
     {
@@ -75,5 +139,286 @@ on_write(
     return rv;
 }
 
+auto
+file_body::
+on_write(
+    buffers::const_buffer_span bs,
+    bool more) ->
+        sink::results
+{
+    sink::results rv;
+#if BOOST_HTTP_PROTO_FILE_IS_POSIX
+    if(buffers::buffer_size(bs) <= n_)
+    {
+        // one system call for
+        // the whole sequence
+        rv.bytes = f_.write(bs, rv.ec);
+        n_ -= rv.bytes;
+        return rv;
+    }
+#endif
+    auto it = bs.begin();
+    auto const end = bs.end();
+    while(it != end)
+    {
+        buffers::const_buffer b(*it++);
+        rv += on_write(b, it != end || more);
+        if(rv.ec.failed())
+            break;
+    }
+    return rv;
+}
+
+void
+file_body::
+on_size_hint(std::uint64_t n) noexcept
+{
+#if BOOST_HTTP_PROTO_FILE_IS_POSIX
+    if( n > n_)
+        n = n_;
+    system::error_code ec;
+    f_.preallocate(n, ec);
+#else
+    (void)n;
+#endif
+}
+
+// Read the next block into the bounce
+// buffer. The file position is aligned
+// until the end of the file is reached.
+void
+file_body::
+fill_direct(system::error_code& ec)
+{
+    auto const n = f_.read(dp_, dsize_, ec);
+    dbegin_ = 0;
+    dend_ = n;
+    if(! ec.failed() && n < dsize_)
+    {
+        // end of file
+        if(n_ > n)
+            n_ = n;
+    }
+}
+
+auto
+file_body::
+read_direct(
+    buffers::mutable_buffer b) ->
+        source::results
+{
+    source::results rv;
+    auto const a = direct_alignment();
+    if(! dinit_)
+    {
+        dinit_ = true;
+        auto const pos = f_.pos(rv.ec);
+        if(rv.ec.failed())
+            return rv;
+        auto const skip = static_cast<
+            std::size_t>(pos & (a - 1));
+        if(skip != 0 && n_ > 0)
+        {
+            // start from the enclosing block
+            f_.seek(pos - skip, rv.ec);
+            if(rv.ec.failed())
+                return rv;
+            fill_direct(rv.ec);
+            if(rv.ec.failed())
+                return rv;
+            if(skip >= dend_)
+            {
+                dbegin_ = dend_;
+                n_ = 0;
+            }
+            else
+            {
+                dbegin_ = skip;
+                if( dend_ < dsize_ &&
+                    n_ > dend_ - skip)
+                    n_ = dend_ - skip;
+            }
+        }
+    }
+    auto p = static_cast<
+        unsigned char*>(b.data());
+    auto size = b.size();
+    while(size > 0 && n_ > 0)
+    {
+        if(dbegin_ == dend_)
+        {
+            if( size >= a && (reinterpret_cast<
+                std::uintptr_t>(p) & (a - 1)) == 0)
+            {
+                // read straight into the
+                // caller's buffer
+                auto const amount = size & ~(a - 1);
+                auto n = f_.read(p, amount, rv.ec);
+                if(n > n_)
+                    n = static_cast<std::size_t>(n_);
+                rv.bytes += n;
+                n_ -= n;
+                if(rv.ec.failed())
+                    break;
+                if(n < amount)
+                {
+                    // end of file
+                    n_ = 0;
+                    break;
+                }
+                p += n;
+                size -= n;
+                continue;
+            }
+            fill_direct(rv.ec);
+            if(rv.ec.failed() || dend_ == 0)
+                break;
+        }
+        std::size_t n = dend_ - dbegin_;
+        if( n > size)
+            n = size;
+        if( n > n_)
+            n = static_cast<std::size_t>(n_);
+        std::memcpy(p, dp_ + dbegin_, n);
+        dbegin_ += n;
+        rv.bytes += n;
+        n_ -= n;
+        p += n;
+        size -= n;
+    }
+    rv.finished = n_ == 0;
+    return rv;
+}
+
+//------------------------------------------------
+
+namespace {
+
+struct sidecar
+{
+    encoding id;
+    core::string_view coding;
+    core::string_view ext;
+};
+
+// in order of preference
+sidecar const sidecars[] = {
+    { encoding::br,   "br",   ".br"  },
+    { encoding::zstd, "zstd", ".zst" },
+    { encoding::gzip, "gzip", ".gz"  } };
+
+constexpr std::size_t num_sidecars =
+    sizeof(sidecars) / sizeof(sidecars[0]);
+
+// Add Accept-Encoding to Vary, unless
+// it is already present
+void
+add_vary(message_base& m)
+{
+    for(auto v : m.find_all(field::vary))
+    {
+        auto rv = grammar::parse(
+            v, list_rule(token_rule, 1));
+        if(! rv)
+            continue;
+        for(auto t : *rv)
+        {
+            if( t == "*" ||
+                grammar::ci_is_equal(
+                    t, "accept-encoding"))
+                return;
+        }
+    }
+    m.append(field::vary, "Accept-Encoding");
+}
+
+} // (anon)
+
+file_body
+open_precompressed(
+    core::string_view path,
+    core::string_view accept_encoding,
+    message_base& m,
+    system::error_code& ec)
+{
+    detail::encoding_weights w;
+    w.add(accept_encoding);
+    unsigned q[num_sidecars];
+    for(std::size_t i = 0; i < num_sidecars; ++i)
+        q[i] = w.get(sidecars[i].id);
+
+    // higher qvalues first, ties
+    // keep the order of preference
+    std::size_t order[num_sidecars];
+    for(std::size_t i = 0; i < num_sidecars; ++i)
+        order[i] = i;
+    std::stable_sort(
+        order, order + num_sidecars,
+        [&q](std::size_t a, std::size_t b)
+        {
+            return q[a] > q[b];
+        });
+
+    // as in negotiate_encoding, a listed identity
+    // with a higher qvalue wins over a sidecar,
+    // while an implicit identity never does
+    auto const identity_q =
+        w.get(encoding::identity);
+    bool const listed =
+        w.q[static_cast<int>(
+            encoding::identity)] >= 0 ||
+        w.any >= 0;
+
+    std::string s;
+    s.reserve(path.size() + 4);
+    file f;
+    core::string_view coding;
+    for(auto i : order)
+    {
+        if( q[i] == 0 ||
+            (listed && q[i] < identity_q))
+            break;
+        s.assign(path.data(), path.size());
+        s.append(
+            sidecars[i].ext.data(),
+            sidecars[i].ext.size());
+        f.open(s.c_str(), file_mode::scan, ec);
+        if(! ec.failed())
+        {
+            coding = sidecars[i].coding;
+            break;
+        }
+    }
+
+    if(coding.empty())
+    {
+        // "identity;q=0" or "*;q=0"
+        // refuses the uncompressed file
+        if(identity_q == 0)
+        {
+            ec = BOOST_HTTP_PROTO_ERR(
+                error::not_acceptable);
+            return file_body(file(), 0);
+        }
+        s.assign(path.data(), path.size());
+        f.open(s.c_str(), file_mode::scan, ec);
+        if(ec.failed())
+            return file_body(file(), 0);
+    }
+
+    auto const n = f.size(ec);
+    if(ec.failed())
+        return file_body(file(), 0);
+
+    if(coding.empty())
+        m.erase(field::content_encoding);
+    else
+        m.set(field::content_encoding, coding);
+    m.set_payload_size(n);
+    add_vary(m);
+
+    return file_body(std::move(f), n);
+}
+
 } // http_proto
 } // boost
@@ -0,0 +1,156 @@
+//
+// Copyright (c) 2026 agent (agent@local)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/cppalliance/http_proto
+//
+
+#include <boost/http_proto/file_mmap.hpp>
+
+#if BOOST_HTTP_PROTO_USE_POSIX_FILE
+
+#include <errno.h>
+#include <sys/mman.h>
+#include <unistd.h>
+
+namespace boost {
+namespace http_proto {
+
+namespace {
+
+std::size_t
+page_size() noexcept
+{
+    static std::size_t const n =
+        static_cast<std::size_t>(
+            ::sysconf(_SC_PAGESIZE));
+    return n;
+}
+
+} // (anon)
+
+file_mmap::
+~file_mmap()
+{
+    unmap(map_size_);
+}
+
+file_mmap::
+file_mmap(
+    file_posix&& f,
+    std::uint64_t size,
+    std::size_t window_size) noexcept
+    : f_(std::move(f))
+    , n_(size)
+    , window_(window_size)
+{
+    if(window_ < page_size())
+        window_ = page_size();
+}
+
+void
+file_mmap::
+unmap(std::size_t n) noexcept
+{
+    if(n == 0)
+        return;
+    ::munmap(map_, n);
+    map_ += n;
+    map_pos_ += n;
+    map_size_ -= n;
+    if(map_size_ == 0)
+        map_ = nullptr;
+}
+
+auto
+file_mmap::
+on_prepare() ->
+    results
+{
+    results rv;
+    if(! init_)
+    {
+        pos_ = f_.pos(rv.ec);
+        if(rv.ec.failed())
+            return rv;
+        auto const size = f_.size(rv.ec);
+        if(rv.ec.failed())
+            return rv;
+        end_ = pos_ > size ? pos_ : size;
+        if(end_ - pos_ > n_)
+            end_ = pos_ + n_;
+        map_pos_ = pos_;
+        init_ = true;
+    }
+
+    if(pos_ >= map_pos_ + map_size_)
+    {
+        // the current window is used up
+        unmap(map_size_);
+        if(pos_ == end_)
+        {
+            rv.finished = true;
+            return rv;
+        }
+
+        // mmap requires a page-aligned offset
+        auto const base = pos_ &
+            ~std::uint64_t(page_size() - 1);
+        auto len = end_ - base;
+        if(len > (pos_ - base) + window_)
+            len = (pos_ - base) + window_;
+        void* p = ::mmap(
+            nullptr,
+            static_cast<std::size_t>(len),
+            PROT_READ,
+            MAP_SHARED,
+            f_.native_handle(),
+            static_cast<::off_t>(base));
+        if(p == MAP_FAILED)
+        {
+            rv.ec.assign(errno,
+                system::system_category());
+            return rv;
+        }
+        map_ = static_cast<unsigned char*>(p);
+        map_size_ = static_cast<std::size_t>(len);
+        map_pos_ = base;
+
+    #ifdef MADV_SEQUENTIAL
+        ::madvise(p, map_size_, MADV_SEQUENTIAL);
+    #endif
+    #ifdef MADV_WILLNEED
+        ::madvise(p, map_size_, MADV_WILLNEED);
+    #endif
+    }
+
+    auto const off = static_cast<
+        std::size_t>(pos_ - map_pos_);
+    rv.data = {
+        map_ + off,
+        map_size_ - off };
+    rv.finished =
+        map_pos_ + map_size_ == end_;
+    return rv;
+}
+
+void
+file_mmap::
+on_consume(std::size_t n) noexcept
+{
+    pos_ += n;
+
+    // release whole pages behind
+    // the consumed position
+    auto const k = static_cast<std::size_t>(
+        pos_ - map_pos_) & ~(page_size() - 1);
+    if(k < map_size_)
+        unmap(k);
+}
+
+} // http_proto
+} // boost
+
+#endif
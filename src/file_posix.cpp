@@ -77,6 +77,7 @@ file_posix::
 file_posix(
     file_posix&& other) noexcept
     : fd_(boost::exchange(other.fd_, -1))
+    , direct_(boost::exchange(other.direct_, false))
 {
 }
 
@@ -89,7 +90,9 @@ operator=(
         return *this;
     native_close(fd_);
     fd_ = other.fd_;
+    direct_ = other.direct_;
     other.fd_ = -1;
+    other.direct_ = false;
     return *this;
 }
 
@@ -99,6 +102,7 @@ native_handle(native_handle_type fd)
 {
     native_close(fd_);
     fd_ = fd;
+    direct_ = false;
 }
 
 void
@@ -107,6 +111,7 @@ close(
     system::error_code& ec)
 {
     auto const ev = native_close(fd_);
+    direct_ = false;
     if(ev)
         ec.assign(ev,
             system::system_category());
@@ -124,6 +129,7 @@ open(char const* path, file_mode mode, system::error_code& ec)
             system::system_category());
     else
         ec = {};
+    direct_ = false;
 
     int f = 0;
 #if BOOST_HTTP_PROTO_USE_POSIX_FADVISE
@@ -350,6 +356,173 @@ write(void const* buffer, std::size_t n,
     return nwritten;
 }
 
+std::size_t
+file_posix::
+write(
+    buffers::const_buffer_span bs,
+    system::error_code& ec)
+{
+    if(fd_ == -1)
+    {
+        ec = make_error_code(
+            system::errc::bad_file_descriptor);
+        return 0;
+    }
+#ifdef IOV_MAX
+    constexpr std::size_t max_iov =
+        IOV_MAX < 64 ? IOV_MAX : 64;
+#else
+    constexpr std::size_t max_iov = 16;
+#endif
+    ::iovec iov[max_iov];
+    auto it = bs.begin();
+    auto const end = bs.end();
+    std::size_t skip = 0; // written from *it
+    std::size_t nwritten = 0;
+    for(;;)
+    {
+        std::size_t n = 0;
+        std::size_t off = skip;
+        for(auto p = it;
+            p != end && n < max_iov; ++p)
+        {
+            buffers::const_buffer b(*p);
+            if(b.size() > off)
+            {
+                iov[n].iov_base = const_cast<char*>(
+                    static_cast<char const*>(
+                        b.data()) + off);
+                iov[n].iov_len = b.size() - off;
+                ++n;
+            }
+            off = 0;
+        }
+        if(n == 0)
+            break;
+        auto const result = ::writev(
+            fd_, iov, static_cast<int>(n));
+        if(result == -1)
+        {
+            auto const ev = errno;
+            if(ev == EINTR)
+                continue;
+            ec.assign(ev,
+                system::system_category());
+            return nwritten;
+        }
+        auto r = static_cast<std::size_t>(result);
+        nwritten += r;
+        // advance past the written data
+        while(it != end)
+        {
+            auto const left =
+                buffers::const_buffer(
+                    *it).size() - skip;
+            if(r < left)
+            {
+                skip += r;
+                break;
+            }
+            r -= left;
+            skip = 0;
+            ++it;
+        }
+    }
+    ec = {};
+    return nwritten;
+}
+
+void
+file_posix::
+preallocate(
+    std::uint64_t n,
+    system::error_code& ec)
+{
+    if(fd_ == -1)
+    {
+        ec = make_error_code(
+            system::errc::bad_file_descriptor);
+        return;
+    }
+#if defined(__linux__) && defined(FALLOC_FL_KEEP_SIZE)
+    auto const pos = ::lseek(fd_, 0, SEEK_CUR);
+    if(pos == -1)
+    {
+        ec.assign(errno,
+            system::system_category());
+        return;
+    }
+    if(n > 0 && ::fallocate(fd_,
+        FALLOC_FL_KEEP_SIZE, pos,
+        static_cast<off_t>(n)) != 0)
+    {
+        auto const ev = errno;
+        // a hint, where unsupported
+        if( ev != EOPNOTSUPP &&
+            ev != ENOSYS)
+        {
+            ec.assign(ev,
+                system::system_category());
+            return;
+        }
+    }
+#else
+    (void)n;
+#endif
+    ec = {};
+}
+
+void
+file_posix::
+set_direct(
+    bool on,
+    system::error_code& ec)
+{
+    if(fd_ == -1)
+    {
+        ec = make_error_code(
+            system::errc::bad_file_descriptor);
+        return;
+    }
+#if defined(O_DIRECT)
+    auto const flags = ::fcntl(fd_, F_GETFL);
+    if(flags == -1)
+    {
+        ec.assign(errno,
+            system::system_category());
+        return;
+    }
+    auto const f = on ?
+        (flags | O_DIRECT) :
+        (flags & ~O_DIRECT);
+    // fails with EINVAL if the
+    // file system does not support it
+    if( f != flags &&
+        ::fcntl(fd_, F_SETFL, f) == -1)
+    {
+        ec.assign(errno,
+            system::system_category());
+        return;
+    }
+#elif defined(F_NOCACHE)
+    if(::fcntl(fd_, F_NOCACHE, on ? 1 : 0) == -1)
+    {
+        ec.assign(errno,
+            system::system_category());
+        return;
+    }
+#else
+    if(on)
+    {
+        ec = make_error_code(
+            system::errc::operation_not_supported);
+        return;
+    }
+#endif
+    direct_ = on;
+    ec = {};
+}
+
 } // http_proto
 } // boost
 
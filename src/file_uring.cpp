@@ -0,0 +1,131 @@
+//
+// Copyright (c) 2026 agent (agent@local)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/cppalliance/http_proto
+//
+
+#include <boost/http_proto/file_uring.hpp>
+
+#if BOOST_HTTP_PROTO_USE_IO_URING
+
+namespace boost {
+namespace http_proto {
+
+namespace {
+
+// waits on the calling thread
+struct waiter
+    : uring_service::operation
+{
+    int res = 0;
+    bool done = false;
+
+    void
+    on_complete(int res_) noexcept override
+    {
+        res = res_;
+        done = true;
+    }
+
+    std::size_t
+    wait(
+        uring_service& svc,
+        system::error_code& ec)
+    {
+        while(! done)
+            svc.run_one();
+        if(res < 0)
+        {
+            ec.assign(-res,
+                system::system_category());
+            return 0;
+        }
+        ec = {};
+        return static_cast<std::size_t>(res);
+    }
+};
+
+} // (anon)
+
+file_uring::
+file_uring(context& ctx)
+    : svc_(&ctx.get_service<uring_service>())
+{
+}
+
+file_uring::
+file_uring(
+    context& ctx,
+    file_posix&& f)
+    : svc_(&ctx.get_service<uring_service>())
+    , f_(std::move(f))
+{
+}
+
+std::size_t
+file_uring::
+read(
+    void* buffer,
+    std::size_t n,
+    system::error_code& ec) const
+{
+    if(! f_.is_open())
+    {
+        ec = make_error_code(
+            system::errc::bad_file_descriptor);
+        return 0;
+    }
+    waiter w;
+    async_read(buffer, n, w);
+    return w.wait(*svc_, ec);
+}
+
+std::size_t
+file_uring::
+write(
+    void const* buffer,
+    std::size_t n,
+    system::error_code& ec)
+{
+    if(! f_.is_open())
+    {
+        ec = make_error_code(
+            system::errc::bad_file_descriptor);
+        return 0;
+    }
+    waiter w;
+    async_write(buffer, n, w);
+    return w.wait(*svc_, ec);
+}
+
+void
+file_uring::
+async_read(
+    void* buffer,
+    std::size_t n,
+    uring_service::operation& op) const
+{
+    svc_->read(
+        f_.native_handle(), buffer, n,
+        std::uint64_t(-1), op);
+}
+
+void
+file_uring::
+async_write(
+    void const* buffer,
+    std::size_t n,
+    uring_service::operation& op)
+{
+    svc_->write(
+        f_.native_handle(), buffer, n,
+        std::uint64_t(-1), op);
+}
+
+} // http_proto
+} // boost
+
+#endif
@@ -23,6 +23,7 @@
 #include <boost/url/grammar/ci_string.hpp>
 #include <boost/url/grammar/hexdig_chars.hpp>
 
+#include "detail/digester.hpp"
 #include "detail/filter.hpp"
 
 namespace boost {
@@ -418,6 +419,10 @@ parser_service(
     // T
     space_needed += cfg.max_type_erase;
 
+    // digest
+    space_needed += detail::workspace::
+        space_needed<detail::digester>();
+
     // max_codec
     {
         if(cfg.apply_deflate_decoder)
@@ -625,6 +630,8 @@ start_impl(
     nprepare_ = 0;
 
     filter_ = nullptr;
+    digester_ = nullptr;
+    digest_alg_ = digest_algorithm::none;
     eb_ = nullptr;
     sink_ = nullptr;
 
@@ -851,6 +858,9 @@ commit(
                 eb_->commit(n);
                 payload_remain_ -= n;
                 body_total_     += n;
+                if(digester_)
+                    digester_->update_buffers(
+                        eb_->data(), n, eb_->size() - n);
             }
         }
         else
@@ -1039,6 +1049,10 @@ parse(
             ws_.reserve_front(svc_.max_codec);
         }
 
+        if(digest_alg_ != digest_algorithm::none)
+            digester_ = &ws_.emplace<
+                detail::digester>(digest_alg_);
+
         if(is_plain() || how_ == how::elastic)
         {
             cb0_ = { p, cap, overread };
@@ -1067,6 +1081,9 @@ parse(
                 return;
             }
             payload_remain_ = h_.md.payload_size;
+
+            if(!filter_ && how_ == how::sink)
+                sink_->size_hint(payload_remain_);
         }
 
         st_ = state::body;
@@ -1190,6 +1207,8 @@ parse(
                         auto copied = buffers::buffer_copy(
                             cb1_.prepare(cb1_.capacity()),
                             chunk);
+                        if(digester_)
+                            digester_->update_buffers(chunk, copied);
                         chunk_remain_ -= copied;
                         body_avail_   += copied;
                         body_total_   += copied;
@@ -1208,9 +1227,19 @@ parse(
                     {
                         auto sink_rs = sink_->write(
                             chunk, !chunked_body_ended);
+                        if(digester_)
+                            digester_->update_buffers(
+                                chunk, sink_rs.bytes);
                         chunk_remain_ -= sink_rs.bytes;
                         body_total_   += sink_rs.bytes;
                         cb0_.consume(sink_rs.bytes);
+                        if(sink_rs.ec == error::would_block)
+                        {
+                            // the rest is written
+                            // on the next call
+                            ec = sink_rs.ec;
+                            return;
+                        }
                         if(sink_rs.ec.failed())
                         {
                             body_avail_ += 
@@ -1234,6 +1263,9 @@ parse(
                         buffers::buffer_copy(
                             eb_->prepare(chunk_avail),
                             chunk);
+                        if(digester_)
+                            digester_->update_buffers(
+                                chunk, chunk_avail);
                         chunk_remain_ -= chunk_avail;
                         body_total_   += chunk_avail;
                         cb0_.consume(chunk_avail);
@@ -1299,6 +1331,13 @@ parse(
                 {
                 case how::in_place:
                 {
+                    // the new bytes follow the
+                    // body which is available
+                    if(digester_)
+                        digester_->update_buffers(
+                            cb0_.data(),
+                            payload_avail,
+                            body_avail_);
                     payload_remain_ -= payload_avail;
                     body_avail_     += payload_avail;
                     body_total_     += payload_avail;
@@ -1319,7 +1358,21 @@ parse(
                             cb0_.data(),
                             payload_avail),
                         !is_complete);
+                    if(digester_)
+                        digester_->update_buffers(
+                            cb0_.data(), sink_rs.bytes);
                     cb0_.consume(sink_rs.bytes);
+                    if(sink_rs.ec == error::would_block)
+                    {
+                        // the rest is written
+                        // on the next call
+                        payload_remain_ +=
+                            payload_avail - sink_rs.bytes;
+                        body_total_ -=
+                            payload_avail - sink_rs.bytes;
+                        ec = sink_rs.ec;
+                        return;
+                    }
                     if(sink_rs.ec.failed())
                     {
                         body_avail_ += 
@@ -1351,6 +1404,9 @@ parse(
                         buffers::buffer_copy(
                             eb_->prepare(payload_avail),
                             cb0_.data());
+                        if(digester_)
+                            digester_->update_buffers(
+                                cb0_.data(), payload_avail);
                         cb0_.consume(payload_avail);
                         eb_->commit(payload_avail);
                         payload_remain_ -= payload_avail;
@@ -1401,6 +1457,13 @@ parse(
                 st_ == state::set_body);
             body_buf.consume(rs.bytes);
             body_avail_ -= rs.bytes;
+            if(rs.ec == error::would_block)
+            {
+                // the rest is written
+                // on the next call
+                ec = rs.ec;
+                return;
+            }
             if(rs.ec.failed())
             {
                 ec  = rs.ec;
@@ -1535,6 +1598,43 @@ set_body_limit(std::uint64_t n)
     }
 }
 
+void
+parser::
+compute_digest(digest_algorithm alg)
+{
+    switch(st_)
+    {
+    case state::header:
+    case state::header_done:
+        digest_alg_ = alg;
+        break;
+    case state::complete_in_place:
+        // only allowed for empty bodies
+        if(body_total_ == 0)
+        {
+            digest_alg_ = alg;
+            break;
+        }
+        BOOST_FALLTHROUGH;
+    default:
+        // compute_digest before parsing the body
+        detail::throw_logic_error();
+    }
+}
+
+digest
+parser::
+body_digest() const noexcept
+{
+    if(digester_)
+        return digester_->result();
+    if(digest_alg_ == digest_algorithm::none)
+        return {};
+    // the body was empty
+    return detail::digester(
+        digest_alg_).result();
+}
+
 //------------------------------------------------
 //
 // Implementation
@@ -1553,7 +1653,16 @@ on_set_body() noexcept
     nprepare_ = 0; // invalidate
 
     if(st_ == state::body)
+    {
+        // the buffered body is
+        // written to the sink first
+        if( how_ == how::sink &&
+            !filter_ &&
+            h_.md.payload == payload::size)
+            sink_->size_hint(
+                payload_remain_ + body_avail_);
         st_ = state::set_body;
+    }
 }
 
 std::size_t
@@ -1605,6 +1714,9 @@ apply_filter(
             }
         }();
 
+        if(digester_)
+            digester_->update_buffers(
+                cb0_.data(), f_rs.in_bytes);
         cb0_.consume(f_rs.in_bytes);
         payload_avail -= f_rs.in_bytes;
         body_total_   += f_rs.out_bytes;
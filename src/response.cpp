@@ -11,6 +11,9 @@
 #include <boost/http_proto/response.hpp>
 #include <boost/http_proto/response_view.hpp>
 #include <boost/http_proto/version.hpp>
+#include <boost/http_proto/service/date_service.hpp>
+
+#include <cstring>
 
 #include <utility>
 
@@ -116,6 +119,32 @@ response(
         set_start_line(sc, v);
 }
 
+void
+response::
+set_date_now(context& ctx)
+{
+    auto& ds = ctx.get_service<
+        date_service>();
+    char buf[date_service::size];
+    ds.copy(buf);
+
+    // overwrite a previous date in place
+    if(count(field::date) == 1)
+    {
+        auto const tab = h_.tab();
+        auto& e = tab[h_.find(field::date)];
+        if(e.vn == date_service::size)
+        {
+            std::memcpy(
+                h_.buf + h_.prefix + e.vp,
+                buf, date_service::size);
+            return;
+        }
+    }
+    set(field::date, core::string_view(
+        buf, date_service::size));
+}
+
 //------------------------------------------------
 
 void
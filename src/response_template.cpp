@@ -0,0 +1,182 @@
+//
+// Copyright (c) 2026 agent (agent@local)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/cppalliance/http_proto
+//
+
+#include <boost/http_proto/response_template.hpp>
+#include <boost/http_proto/detail/except.hpp>
+#include <boost/http_proto/field.hpp>
+#include <boost/url/grammar/parse.hpp>
+#include <boost/url/grammar/unsigned_rule.hpp>
+#include <cstring>
+#include <string>
+
+#include "detail/number_string.hpp"
+
+namespace boost {
+namespace http_proto {
+
+namespace {
+
+// field-content without leading
+// or trailing whitespace
+bool
+is_slot_value(
+    core::string_view s) noexcept
+{
+    if(s.empty())
+        return true;
+    if( s.front() == ' ' || s.front() == '\t' ||
+        s.back() == ' ' || s.back() == '\t')
+        return false;
+    for(char c : s)
+    {
+        auto const u =
+            static_cast<unsigned char>(c);
+        if( u != ' ' && u != '\t' &&
+            (u < 0x21 || u == 0x7f))
+            return false;
+    }
+    return true;
+}
+
+} // (anon)
+
+response_template::
+response_template(
+    response const& res,
+    std::initializer_list<slot> slots)
+    : res_(res)
+{
+    for(auto const& s : slots)
+    {
+        if(s.width == 0)
+            detail::throw_invalid_argument();
+        switch(string_to_field(s.name))
+        {
+        case field::connection:
+        case field::content_encoding:
+        case field::expect:
+        case field::transfer_encoding:
+        case field::upgrade:
+            detail::throw_invalid_argument();
+        default:
+            break;
+        }
+    }
+
+    // remove every field named by a slot
+    // first, so that a slot is never erased
+    // after its position is recorded
+    for(auto const& s : slots)
+    {
+        res_.erase(s.name);
+        if(string_to_field(s.name) ==
+                field::content_length)
+            res_.erase(field::transfer_encoding);
+    }
+
+    slots_.reserve(slots.size());
+    for(auto const& s : slots)
+    {
+        res_.append(s.name,
+            std::string(s.width, '0')).value();
+        auto& h = detail::header::get(res_);
+        auto const i = h.count - 1;
+        slots_.push_back({
+            i, h.tab()[i].vp, s.width });
+    }
+
+    // a run of zeros is not a valid
+    // Content-Length, so every slot
+    // starts out as a single zero
+    for(std::size_t i = 0;
+            i < slots_.size(); ++i)
+        set(res_, i, "0");
+}
+
+void
+response_template::
+apply(response& res) const
+{
+    res = res_;
+}
+
+void
+response_template::
+set(
+    response& res,
+    std::size_t i,
+    core::string_view value) const
+{
+    static
+    constexpr
+    grammar::unsigned_rule<
+        std::uint64_t> num_rule{};
+
+    if(i >= slots_.size())
+        detail::throw_invalid_argument();
+    auto const& s = slots_[i];
+    if(value.size() > s.width)
+        detail::throw_length_error();
+    if(! is_slot_value(value))
+        detail::throw_invalid_argument();
+
+    auto& h = detail::header::get(res);
+    if( h.size != res_.buffer().size() ||
+        h.count != res_.size())
+        detail::throw_invalid_argument();
+    auto& e = h.tab()[s.index];
+    if( e.vp < s.vp ||
+        e.vp + e.vn != s.vp + s.width)
+        detail::throw_invalid_argument();
+
+    std::uint64_t n = 0;
+    if(e.id == field::content_length)
+    {
+        auto rv = grammar::parse(
+            value, num_rule);
+        if(! rv)
+            detail::throw_invalid_argument();
+        n = *rv;
+    }
+
+    // right-align, the padding
+    // becomes optional whitespace
+    auto const pad =
+        s.width - value.size();
+    auto const dest =
+        h.buf + h.prefix + s.vp;
+    std::memset(dest, ' ', pad);
+    std::memcpy(dest + pad,
+        value.data(), value.size());
+    e.vp = static_cast<
+        offset_type>(s.vp + pad);
+    e.vn = static_cast<
+        offset_type>(value.size());
+
+    if(e.id == field::content_length)
+    {
+        h.md.content_length.ec = {};
+        h.md.content_length.value = n;
+        h.update_payload();
+    }
+}
+
+void
+response_template::
+set(
+    response& res,
+    std::size_t i,
+    std::uint64_t value) const
+{
+    detail::number_string s(value);
+    set(res, i, s.str());
+}
+
+} // http_proto
+} // boost
@@ -0,0 +1,112 @@
+//
+// Copyright (c) 2026 agent (agent@local)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/cppalliance/http_proto
+//
+
+#include "accept_encoding_rule.hpp"
+
+#include <boost/http_proto/rfc/token_rule.hpp>
+#include <boost/http_proto/rfc/detail/rules.hpp>
+#include <boost/url/grammar/error.hpp>
+#include <boost/url/grammar/parse.hpp>
+
+namespace boost {
+namespace http_proto {
+namespace detail {
+
+auto
+accept_encoding_rule_t::
+parse(
+    char const*& it,
+    char const* end) const noexcept ->
+        system::result<value_type>
+{
+    value_type t;
+
+    // codings
+    {
+        auto rv = grammar::parse(
+            it, end, token_rule);
+        if(! rv)
+            return rv.error();
+        t.coding = *rv;
+    }
+
+    // [ weight ]
+    auto const it0 = it;
+    it = grammar::find_if_not(
+        it, end, ws);
+    if(it == end || *it != ';')
+    {
+        it = it0;
+        return t;
+    }
+    ++it;
+    it = grammar::find_if_not(
+        it, end, ws);
+
+    // "q="
+    if( end - it < 2 ||
+        (it[0] != 'q' && it[0] != 'Q') ||
+        it[1] != '=')
+    {
+        BOOST_HTTP_PROTO_RETURN_EC(
+            grammar::error::syntax);
+    }
+    it += 2;
+
+    // qvalue
+    if(it == end)
+    {
+        BOOST_HTTP_PROTO_RETURN_EC(
+            grammar::error::need_more);
+    }
+    if(*it == '0')
+    {
+        ++it;
+        unsigned q = 0;
+        if(it != end && *it == '.')
+        {
+            ++it;
+            unsigned scale = 100;
+            for(int i = 0; i < 3; ++i)
+            {
+                if( it == end ||
+                    *it < '0' || *it > '9')
+                    break;
+                q += (*it - '0') * scale;
+                scale /= 10;
+                ++it;
+            }
+        }
+        t.q = static_cast<
+            unsigned short>(q);
+        return t;
+    }
+    if(*it == '1')
+    {
+        ++it;
+        if(it != end && *it == '.')
+        {
+            ++it;
+            for(int i = 0; i < 3; ++i)
+            {
+                if(it == end || *it != '0')
+                    break;
+                ++it;
+            }
+        }
+        t.q = 1000;
+        return t;
+    }
+    BOOST_HTTP_PROTO_RETURN_EC(
+        grammar::error::syntax);
+}
+
+} // detail
+} // http_proto
+} // boost
@@ -0,0 +1,103 @@
+//
+// Copyright (c) 2026 agent (agent@local)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/cppalliance/http_proto
+//
+
+#ifndef BOOST_HTTP_PROTO_RFC_ACCEPT_ENCODING_RULE_HPP
+#define BOOST_HTTP_PROTO_RFC_ACCEPT_ENCODING_RULE_HPP
+
+#include <boost/http_proto/detail/config.hpp>
+#include <boost/http_proto/rfc/list_rule.hpp>
+#include <boost/system/result.hpp>
+#include <boost/core/detail/string_view.hpp>
+
+namespace boost {
+namespace http_proto {
+namespace detail {
+
+//------------------------------------------------
+
+/** An element of Accept-Encoding
+*/
+struct accept_encoding
+{
+    /** The content coding, "identity", or "*"
+    */
+    core::string_view coding;
+
+    /** The qvalue, scaled to the range [0, 1000]
+    */
+    unsigned short q = 1000;
+};
+
+//------------------------------------------------
+
+/** Rule to match a coding with an optional weight
+
+    @par Value Type
+    @code
+    using value_type = accept_encoding;
+    @endcode
+
+    @par BNF
+    @code
+    codings = content-coding / "identity" / "*"
+    weight  = OWS ";" OWS "q=" qvalue
+    qvalue  = ( "0" [ "." 0*3DIGIT ] )
+            / ( "1" [ "." 0*3("0") ] )
+    @endcode
+
+    @par Specification
+    @li <a href="https://www.rfc-editor.org/rfc/rfc9110#section-12.5.3"
+        >12.5.3.  Accept-Encoding (rfc9110)</a>
+    @li <a href="https://www.rfc-editor.org/rfc/rfc9110#section-12.4.2"
+        >12.4.2.  Quality Values (rfc9110)</a>
+*/
+#ifdef BOOST_HTTP_PROTO_DOCS
+constexpr __implementation_defined__ accept_encoding_rule;
+#else
+struct accept_encoding_rule_t
+{
+    using value_type = accept_encoding;
+
+    BOOST_HTTP_PROTO_DECL
+    auto
+    parse(
+        char const*& it,
+        char const* end) const noexcept ->
+            system::result<value_type>;
+};
+
+constexpr accept_encoding_rule_t accept_encoding_rule_impl{};
+#endif
+
+//------------------------------------------------
+
+/** Rule matching the Accept-Encoding field value
+
+    @par Value Type
+    @code
+    using value_type = grammar::range< accept_encoding >;
+    @endcode
+
+    @par BNF
+    @code
+    Accept-Encoding  = #( codings [ weight ] )
+    @endcode
+
+    @par Specification
+    @li <a href="https://www.rfc-editor.org/rfc/rfc9110#section-12.5.3"
+        >12.5.3.  Accept-Encoding (rfc9110)</a>
+*/
+constexpr auto accept_encoding_rule =
+    list_rule( accept_encoding_rule_impl );
+
+} // detail
+} // http_proto
+} // boost
+
+#endif
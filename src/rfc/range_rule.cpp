@@ -0,0 +1,251 @@
+//
+// Copyright (c) 2026 agent (agent@local)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/cppalliance/http_proto
+//
+
+#include <boost/http_proto/rfc/range_rule.hpp>
+#include <boost/http_proto/error.hpp>
+#include <boost/http_proto/rfc/token_rule.hpp>
+#include <boost/url/grammar/ci_string.hpp>
+#include <boost/url/grammar/error.hpp>
+#include <boost/url/grammar/parse.hpp>
+
+namespace boost {
+namespace http_proto {
+
+namespace {
+
+// 1*DIGIT
+system::result<std::uint64_t>
+parse_pos(
+    char const*& it,
+    char const* end) noexcept
+{
+    auto const it0 = it;
+    std::uint64_t v = 0;
+    while( it != end &&
+        *it >= '0' && *it <= '9')
+    {
+        auto const d = static_cast<
+            unsigned>(*it - '0');
+        if(v > (std::uint64_t(-1) - d) / 10)
+        {
+            it = it0;
+            BOOST_HTTP_PROTO_RETURN_EC(
+                grammar::error::invalid);
+        }
+        v = v * 10 + d;
+        ++it;
+    }
+    if(it == it0)
+    {
+        BOOST_HTTP_PROTO_RETURN_EC(
+            grammar::error::mismatch);
+    }
+    return v;
+}
+
+bool
+touches(
+    byte_range const& a,
+    byte_range const& b) noexcept
+{
+    return
+        a.offset <= b.offset + b.size &&
+        b.offset <= a.offset + a.size;
+}
+
+} // (anon)
+
+auto
+byte_range_spec_rule_t::
+parse(
+    char const*& it,
+    char const* end) const noexcept ->
+        system::result<value_type>
+{
+    value_type t;
+    auto const it0 = it;
+    if(it == end)
+    {
+        BOOST_HTTP_PROTO_RETURN_EC(
+            grammar::error::need_more);
+    }
+
+    // suffix-range
+    if(*it == '-')
+    {
+        ++it;
+        auto rv = parse_pos(it, end);
+        if(! rv)
+        {
+            it = it0;
+            return rv.error();
+        }
+        t.first = *rv;
+        t.is_suffix = true;
+        return t;
+    }
+
+    // int-range
+    {
+        auto rv = parse_pos(it, end);
+        if(! rv)
+            return rv.error();
+        t.first = *rv;
+    }
+    if( it == end ||
+        *it != '-')
+    {
+        it = it0;
+        BOOST_HTTP_PROTO_RETURN_EC(
+            grammar::error::mismatch);
+    }
+    ++it;
+    if( it == end ||
+        *it < '0' || *it > '9')
+        return t;
+    {
+        auto rv = parse_pos(it, end);
+        if(! rv)
+        {
+            it = it0;
+            return rv.error();
+        }
+        t.last = *rv;
+    }
+    if(t.last < t.first)
+    {
+        it = it0;
+        BOOST_HTTP_PROTO_RETURN_EC(
+            grammar::error::invalid);
+    }
+    return t;
+}
+
+auto
+range_rule_t::
+parse(
+    char const*& it,
+    char const* end) const ->
+        system::result<value_type>
+{
+    // range-unit
+    {
+        auto rv = grammar::parse(
+            it, end, token_rule);
+        if(! rv)
+            return rv.error();
+        if(! grammar::ci_is_equal(
+                *rv, "bytes"))
+        {
+            BOOST_HTTP_PROTO_RETURN_EC(
+                grammar::error::mismatch);
+        }
+    }
+    // "="
+    if(it == end)
+    {
+        BOOST_HTTP_PROTO_RETURN_EC(
+            grammar::error::need_more);
+    }
+    if(*it != '=')
+    {
+        BOOST_HTTP_PROTO_RETURN_EC(
+            grammar::error::mismatch);
+    }
+    ++it;
+    // range-set
+    return grammar::parse(it, end,
+        list_rule(byte_range_spec_rule, 1));
+}
+
+//------------------------------------------------
+
+system::result<std::size_t>
+satisfiable_ranges(
+    core::string_view s,
+    std::uint64_t length,
+    byte_range* dest,
+    std::size_t max)
+{
+    auto rv = grammar::parse(s, range_rule);
+    if(! rv)
+        return rv.error();
+
+    std::size_t n = 0;
+    for(auto const& spec : *rv)
+    {
+        byte_range r{};
+        if(spec.is_suffix)
+        {
+            if(spec.first == 0)
+                continue;
+            r.size = spec.first < length ?
+                spec.first : length;
+            r.offset = length - r.size;
+        }
+        else
+        {
+            if(spec.first >= length)
+                continue;
+            r.offset = spec.first;
+            r.size = (spec.last < length ?
+                spec.last + 1 : length) - r.offset;
+        }
+        if(r.size == 0)
+            continue;
+
+        // merge with overlapping or adjoining
+        // ranges, at the position of the first
+        std::size_t k = std::size_t(-1);
+        std::size_t i = 0;
+        while(i < n)
+        {
+            if( i == k ||
+                ! touches(dest[i], r))
+            {
+                ++i;
+                continue;
+            }
+            auto const e0 = dest[i].offset + dest[i].size;
+            auto const e1 = r.offset + r.size;
+            if(r.offset > dest[i].offset)
+                r.offset = dest[i].offset;
+            r.size = (e0 > e1 ? e0 : e1) - r.offset;
+            if(k == std::size_t(-1))
+            {
+                k = i;
+            }
+            else
+            {
+                for(auto j = i + 1; j < n; ++j)
+                    dest[j - 1] = dest[j];
+                --n;
+                if(i < k)
+                    --k;
+            }
+            // the range grew
+            i = 0;
+        }
+        if(k != std::size_t(-1))
+        {
+            dest[k] = r;
+            continue;
+        }
+        if(n == max)
+        {
+            BOOST_HTTP_PROTO_RETURN_EC(
+                error::bad_field_value);
+        }
+        dest[n++] = r;
+    }
+    return n;
+}
+
+} // http_proto
+} // boost
@@ -10,23 +10,195 @@
 //
 
 #include <boost/http_proto/detail/except.hpp>
+#include <boost/http_proto/message_base.hpp>
 #include <boost/http_proto/message_view_base.hpp>
+#include <boost/http_proto/response.hpp>
 #include <boost/http_proto/serializer.hpp>
+#include <boost/http_proto/rfc/range_rule.hpp>
+#include <boost/http_proto/service/compression_cache.hpp>
 #include <boost/http_proto/service/zlib_service.hpp>
 
+#include "detail/digester.hpp"
 #include "detail/filter.hpp"
+#include "detail/number_string.hpp"
+#include "detail/parallel_deflator.hpp"
+#include "detail/spsc_ring.hpp"
 
 #include <boost/buffers/algorithm.hpp>
 #include <boost/buffers/buffer_copy.hpp>
 #include <boost/buffers/buffer_size.hpp>
 #include <boost/core/ignore_unused.hpp>
 
+#include <atomic>
+#include <cmath>
+#include <cstring>
+#include <string>
+#include <limits.h>
 #include <stddef.h>
 
 namespace boost {
 namespace http_proto {
 
 namespace {
+
+// the compression level used by deflator_filter
+constexpr int deflator_level = -1;
+
+// the largest number of buffers
+// in a single gather write
+#ifdef IOV_MAX
+constexpr std::size_t max_iov = IOV_MAX;
+#else
+constexpr std::size_t max_iov = 1024;
+#endif
+
+// the order-0 entropy, in bits per byte, above which
+// deflate is not expected to save an eighth of the
+// size. Compressed or encrypted data measures
+// close to 8.
+constexpr double max_sample_entropy = 7.0;
+
+// Return true if the first `limit` bytes of the
+// buffers look worth compressing
+template<class ConstBufferSequence>
+bool
+is_compressible(
+    ConstBufferSequence const& bs,
+    std::size_t limit) noexcept
+{
+    std::size_t count[256] = {};
+    std::size_t n = 0;
+    for(buffers::const_buffer b : bs)
+    {
+        auto const* p = static_cast<
+            unsigned char const*>(b.data());
+        auto m = b.size();
+        if(m > limit - n)
+            m = limit - n;
+        for(std::size_t i = 0; i < m; ++i)
+            ++count[p[i]];
+        n += m;
+        if(n == limit)
+            break;
+    }
+    if(n == 0)
+        return true;
+
+    double bits = 0;
+    for(auto c : count)
+    {
+        if(c == 0)
+            continue;
+        auto const f =
+            static_cast<double>(c) /
+            static_cast<double>(n);
+        bits -= f * std::log2(f);
+    }
+    return bits <= max_sample_entropy;
+}
+
+// Copy the header without its Content-Encoding
+// fields, returning the number of bytes written
+std::size_t
+copy_without_content_encoding(
+    detail::header const& h,
+    char* dest) noexcept
+{
+    auto const* p = h.cbuf + h.prefix;
+    auto const end = h.size - h.prefix - 2;
+    auto const tab = h.tab();
+    auto* d = dest;
+
+    // start-line
+    std::memcpy(d, h.cbuf, h.prefix);
+    d += h.prefix;
+    for(std::size_t i = 0; i < h.count; ++i)
+    {
+        auto const& e = tab[i];
+        std::size_t const next = (i + 1 < h.count) ?
+            tab[i + 1].np : end;
+        if(e.id == field::content_encoding)
+            continue;
+        std::memcpy(d, p + e.np, next - e.np);
+        d += next - e.np;
+    }
+    // final CRLF
+    std::memcpy(d, "\r\n", 2);
+    d += 2;
+    return d - dest;
+}
+
+// Write "bytes first-last/length",
+// returning one past the end
+char*
+write_content_range(
+    char* dest,
+    byte_range const& r,
+    std::uint64_t length) noexcept
+{
+    detail::number_string const first(r.offset);
+    detail::number_string const last(
+        r.offset + r.size - 1);
+    detail::number_string const len(length);
+    std::memcpy(dest, "bytes ", 6);
+    dest += 6;
+    std::memcpy(dest, first.data(), first.size());
+    dest += first.size();
+    *dest++ = '-';
+    std::memcpy(dest, last.data(), last.size());
+    dest += last.size();
+    *dest++ = '/';
+    std::memcpy(dest, len.data(), len.size());
+    return dest + len.size();
+}
+
+// Return the size of "bytes first-last/length"
+std::size_t
+content_range_size(
+    byte_range const& r,
+    std::uint64_t length) noexcept
+{
+    return 6 +
+        detail::number_string(r.offset).size() + 1 +
+        detail::number_string(
+            r.offset + r.size - 1).size() + 1 +
+        detail::number_string(length).size();
+}
+
+// the size of a multipart boundary
+constexpr std::size_t boundary_size = 16;
+
+// Write a multipart boundary which
+// is unlikely to appear in the parts
+void
+make_boundary(
+    char* dest,
+    void const* p,
+    std::uint64_t salt) noexcept
+{
+    static std::atomic<std::uint64_t> counter{0};
+    std::uint64_t x =
+        counter.fetch_add(1,
+            std::memory_order_relaxed) ^
+        static_cast<std::uint64_t>(
+            reinterpret_cast<std::uintptr_t>(p)) ^
+        (salt * 0x9e3779b97f4a7c15);
+
+    // splitmix64
+    x += 0x9e3779b97f4a7c15;
+    x = (x ^ (x >> 30)) * 0xbf58476d1ce4e5b9;
+    x = (x ^ (x >> 27)) * 0x94d049bb133111eb;
+    x ^= x >> 31;
+
+    static constexpr char hexdig[] =
+        "0123456789abcdef";
+    for(std::size_t i = boundary_size; i--;)
+    {
+        dest[i] = hexdig[x & 0xf];
+        x >>= 4;
+    }
+}
+
 class deflator_filter
     : public http_proto::detail::filter
 {
@@ -38,7 +210,8 @@ public:
         http_proto::detail::workspace& ws,
         bool use_gzip)
         : deflator_{ ctx.get_service<zlib::service>()
-            .make_deflator(ws, -1, use_gzip ? 31 : 15, 8) }
+            .make_deflator(
+                ws, deflator_level, use_gzip ? 31 : 15, 8) }
     {
     }
 
@@ -96,6 +269,74 @@ public:
         }
     }
 };
+
+// Call f with each line of the data of an
+// event, where lines may end in CRLF, LF, or CR
+template<class F>
+void
+for_each_line(
+    core::string_view s,
+    F const& f)
+{
+    std::size_t i = 0;
+    for(;;)
+    {
+        auto j = s.find_first_of("\r\n", i);
+        if( j == core::string_view::npos )
+            return f(s.substr(i));
+        f(s.substr(i, j - i));
+        if( s[j] == '\r' &&
+            j + 1 < s.size() &&
+            s[j + 1] == '\n' )
+            ++j;
+        i = j + 1;
+    }
+}
+
+bool
+has_line_break(
+    core::string_view s) noexcept
+{
+    return s.find_first_of("\r\n") !=
+        core::string_view::npos;
+}
+
+// Copies strings into the free space of
+// a circular buffer, which may wrap around
+class sse_writer
+{
+    buffers::mutable_buffer_pair mbp_;
+    std::size_t i_ = 0;
+
+public:
+    explicit
+    sse_writer(
+        buffers::mutable_buffer_pair const& mbp) noexcept
+        : mbp_(mbp)
+    {
+    }
+
+    void
+    append(core::string_view s) noexcept
+    {
+        while(! s.empty() )
+        {
+            BOOST_ASSERT(i_ < 2);
+            auto& b = mbp_[i_];
+            if( b.size() == 0 )
+            {
+                ++i_;
+                continue;
+            }
+            auto const n = (std::min)(
+                b.size(), s.size());
+            std::memcpy(b.data(), s.data(), n);
+            b += n;
+            s.remove_prefix(n);
+        }
+    }
+};
+
 } // namespace
 
 void
@@ -125,7 +366,7 @@ template<class MutableBuffers>
 void
 write_chunk_header(
     MutableBuffers const& dest0,
-    std::size_t size) noexcept
+    std::uint64_t size) noexcept
 {
     static constexpr char hexdig[] =
         "0123456789ABCDEF";
@@ -211,6 +452,36 @@ reset() noexcept
     filter_done_ = false;
     in_ = nullptr;
     out_ = nullptr;
+    coding_ = encoding::identity;
+    cache_ = nullptr;
+    cached_.reset();
+    cache_body_ = {};
+    cache_value_.reset();
+    sample_size_ = 0;
+    is_sampling_ = false;
+    batch_ends_ = nullptr;
+    batch_size_ = 0;
+    batch_cap_ = 0;
+    batch_done_ = 0;
+    batch_sent_ = 0;
+    batch_last_ = nullptr;
+    min_output_ = 0;
+    max_hold_ = {};
+    is_holding_ = false;
+    flush_ = false;
+    is_msg_end_ = false;
+    region_ = {};
+    region_post_ = {};
+    part_region_ = nullptr;
+    part_pre_ = nullptr;
+    parts_ = 0;
+    vsrc_ = nullptr;
+    view_ = {};
+    digester_ = nullptr;
+    trailer_ = {};
+    last_slot_ = nullptr;
+    last_chunk_out_ = false;
+    is_sse_ = false;
     ws_.clear();
 }
 
@@ -221,6 +492,45 @@ serializer::
 prepare() ->
     system::result<
         const_buffers_type>
+{
+    is_msg_end_ = false;
+    auto rv = prepare_impl();
+    if( rv.has_error() )
+        return rv;
+    if( record_size_ > 0 &&
+        st_ != style::region )
+        rv = shape_output(*rv);
+    is_msg_end_ = ends_message(*rv);
+    return rv;
+}
+
+// Return true if consuming all of
+// the output completes the message
+bool
+serializer::
+ends_message(
+    const_buffers_type cbs) const noexcept
+{
+    if( is_expect_continue_ )
+        return false;
+    if( buffers::buffer_size(cbs) !=
+            buffers::buffer_size(prepped_) )
+        return false;
+    if( st_ == style::region )
+        return region_.size == 0 && parts_ == 0;
+    if( filter_ )
+        return filter_done_;
+    if( st_ == style::empty ||
+        st_ == style::buffers )
+        return true;
+    return ! more_;
+}
+
+auto
+serializer::
+prepare_impl() ->
+    system::result<
+        const_buffers_type>
 {
     // Precondition violation
     if( is_done_ )
@@ -236,13 +546,173 @@ prepare() ->
             error::expect_100_continue);
     }
 
-    if( st_ == style::empty )
+    // these may hold queued messages
+    if( st_ == style::empty ||
+        (st_ == style::buffers && !filter_) )
+    {
+        last_chunk_out_ = true;
         return const_buffers_type(
-            prepped_.data(), prepped_.size());
+            prepped_.data(),
+            (std::min)(prepped_.size(), max_iov));
+    }
 
-    if( st_ == style::buffers && !filter_ )
+    // empty while the region is sent
+    if( st_ == style::region )
+    {
+        if( !more_ )
+            last_chunk_out_ = true;
         return const_buffers_type(
             prepped_.data(), prepped_.size());
+    }
+
+    // produce the next view
+    bool fetched = false;
+    auto fetch = [&]() -> system::error_code
+    {
+        auto rs = vsrc_->prepare();
+        if( rs.ec == error::would_block )
+        {
+            // repeated after the
+            // source is ready
+            return rs.ec;
+        }
+        if( rs.ec.failed() )
+        {
+            is_done_ = true;
+            return rs.ec;
+        }
+
+        // only the last data may be empty
+        if( rs.data.size() == 0 && !rs.finished )
+            detail::throw_logic_error();
+
+        view_ = rs.data;
+        more_ = !rs.finished;
+        fetched = true;
+        if( digester_ && !filter_ )
+            digester_->update(
+                view_.data(), view_.size());
+        return {};
+    };
+
+    if( st_ == style::view )
+    {
+        if( is_sampling_ )
+        {
+            auto ec = fetch();
+            if( ec.failed() )
+                return ec;
+            is_sampling_ = false;
+            if(! is_compressible(
+                buffers::const_buffer_span(&view_, 1),
+                sample_size_) )
+            {
+                // send the view as-is
+                filter_ = nullptr;
+                coding_ = encoding::identity;
+                hdr_ = hdr_identity_;
+                *hp_ = hdr_;
+                in_ = nullptr;
+                out_ = nullptr;
+                if( digester_ )
+                    digester_->update(
+                        view_.data(), view_.size());
+            }
+        }
+
+        if( !filter_ )
+        {
+            // the output refers to the view,
+            // which is consumed from the source
+            // once all of the output is consumed
+            if( view_.size() == 0 && more_ )
+            {
+                auto ec = fetch();
+                if( ec.failed() )
+                    return ec;
+            }
+            if( fetched )
+            {
+                std::size_t n = 0;
+                if( !is_header_done_ )
+                    ++n;
+                else
+                    prepped_.reset(prepped_.capacity());
+
+                if( !is_chunked_ )
+                {
+                    prepped_[n++] = view_;
+                }
+                else
+                {
+                    if( view_.size() > 0 )
+                    {
+                        write_chunk_header(
+                            chunk_header_, view_.size());
+                        prepped_[n++] = chunk_header_;
+                        prepped_[n++] = view_;
+                        prepped_[n++] = chunk_close_;
+                    }
+                    if( !more_ )
+                    {
+                        prepped_[n++] = last_chunk_;
+                        prepped_[n++] = trailer_;
+                        last_chunk_out_ = true;
+                    }
+                }
+            }
+            return const_buffers_type(
+                prepped_.data(), prepped_.size());
+        }
+    }
+
+    if( is_sampling_ )
+    {
+        // fill the sample before the
+        // header commits to an encoding
+        auto& input = *in_;
+        auto limit =
+            input.size() + input.capacity();
+        if( limit > sample_size_ )
+            limit = sample_size_;
+        while( more_ && input.size() < limit )
+        {
+            if( st_ == style::stream )
+                BOOST_HTTP_PROTO_RETURN_EC(
+                    error::need_data);
+
+            auto results = src_->read(
+                input.prepare(input.capacity()));
+            if( results.ec == error::would_block )
+            {
+                // repeated after the
+                // source is ready
+                input.commit(results.bytes);
+                return results.ec;
+            }
+            if(results.ec.failed())
+            {
+                is_done_ = true;
+                return results.ec;
+            }
+            more_ = !results.finished;
+            input.commit(results.bytes);
+        }
+        is_sampling_ = false;
+
+        if(! is_compressible(input.data(), limit) )
+        {
+            // send the input as-is
+            filter_ = nullptr;
+            coding_ = encoding::identity;
+            hdr_ = hdr_identity_;
+            *hp_ = hdr_;
+            out_ = in_;
+            if( digester_ )
+                digester_->update_buffers(
+                    input.data(), input.size());
+        }
+    }
 
     // TODO: This is a temporary solution until we refactor
     // the implementation for efficient partial buffer consumption.
@@ -252,27 +722,6 @@ prepare() ->
 
     auto& input = *in_;
     auto& output = *out_;
-    if( st_ == style::source && more_ )
-    {
-        auto results = src_->read(
-            input.prepare(input.capacity()));
-        if(results.ec.failed())
-        {
-            is_done_ = true;
-            return results.ec;
-        }
-        more_ = !results.finished;
-        input.commit(results.bytes);
-    }
-
-    if( st_ == style::stream &&
-        more_ &&
-        in_->size() == 0 )
-        BOOST_HTTP_PROTO_RETURN_EC(error::need_data);
-
-    bool has_avail_out =
-        ((!filter_ && (more_ || input.size() > 0)) ||
-        (filter_ && !filter_done_));
 
     auto get_input = [&]() -> buffers::const_buffer
     {
@@ -285,6 +734,10 @@ prepare() ->
             BOOST_ASSERT(buf.size() > 0);
             return buf;
         }
+        else if( st_ == style::view )
+        {
+            return view_;
+        }
         else
         {
             if( input.size() == 0 )
@@ -325,48 +778,170 @@ prepare() ->
             if( buffers::buffer_size(buf_) == 0 )
                 more_ = false;
         }
+        else if( st_ == style::view )
+        {
+            // the filter keeps its own copy
+            view_ += n;
+            vsrc_->consume(n);
+        }
         else
             input.consume(n);
     };
 
+    bool has_avail_out = false;
+    bool would_block = false;
     std::size_t num_written = 0;
-    if( !filter_ )
-        num_written += input.size();
-    else
+    for(;;)
     {
-        for(;;)
+        if( st_ == style::view &&
+            more_ &&
+            view_.size() == 0 )
         {
-            auto in = get_input();
-            auto out = get_output();
-            if( out.size() == 0 )
+            auto ec = fetch();
+            if( ec == error::would_block )
             {
-                if( output.size() == 0 )
-                    detail::throw_logic_error();
+                // send what the filter
+                // produced so far
+                would_block = true;
                 break;
             }
+            if( ec.failed() )
+                return ec;
+        }
 
-            auto rs = filter_->process(
-                out, in, more_);
-
-            if(rs.ec.failed())
+        while( st_ == style::source && more_ )
+        {
+            auto const mbs =
+                input.prepare(input.capacity());
+            auto results = src_->read(mbs);
+            if( results.ec == error::would_block )
+            {
+                // send what is available, and
+                // read again on the next call
+                would_block = true;
+                results.ec = {};
+            }
+            else if(results.ec.failed())
             {
                 is_done_ = true;
-                return rs.ec;
+                return results.ec;
             }
+            more_ = !results.finished;
+            if( digester_ && !filter_ )
+                digester_->update_buffers(
+                    mbs, results.bytes);
+            input.commit(results.bytes);
+
+            // gather small pieces
+            if( filter_ ||
+                would_block ||
+                input.size() >= min_output_ ||
+                input.capacity() == 0 )
+                break;
+        }
 
-            if( rs.finished )
-                filter_done_ = true;
+        // events do not wait for the header
+        if( st_ == style::stream &&
+            more_ &&
+            in_->size() == 0 &&
+            (is_header_done_ || !is_sse_) )
+            BOOST_HTTP_PROTO_RETURN_EC(error::need_data);
 
-            consume(rs.in_bytes);
+        has_avail_out =
+            ((!filter_ && (more_ || input.size() > 0)) ||
+            (filter_ && !filter_done_));
 
-            if( rs.out_bytes == 0 )
-                break;
+        if( !filter_ )
+            num_written += input.size();
+        else
+        {
+            for(;;)
+            {
+                auto in = get_input();
+                auto out = get_output();
+                if( out.size() == 0 )
+                {
+                    if( output.size() == 0 )
+                        detail::throw_logic_error();
+                    break;
+                }
+
+                auto rs = filter_->process(
+                    out, in, more_);
+
+                if(rs.ec.failed())
+                {
+                    is_done_ = true;
+                    return rs.ec;
+                }
+
+                if( rs.finished )
+                    filter_done_ = true;
+
+                consume(rs.in_bytes);
+
+                if( rs.out_bytes == 0 )
+                {
+                    // the filter may hold on to input
+                    // without producing output yet
+                    if( rs.in_bytes > 0 )
+                        continue;
+                    break;
+                }
+
+                num_written += rs.out_bytes;
+                output.commit(rs.out_bytes);
+
+                if( digester_ )
+                    digester_->update(
+                        out.data(), rs.out_bytes);
+
+                if( cache_ )
+                    cache_value_->append(
+                        static_cast<char const*>(out.data()),
+                        rs.out_bytes);
+            }
 
-            num_written += rs.out_bytes;
-            output.commit(rs.out_bytes);
+            if( cache_ && filter_done_ )
+            {
+                cache_->insert(
+                    buffers::const_buffer_span(
+                        cache_body_.data(),
+                        cache_body_.size()),
+                    coding_,
+                    deflator_level,
+                    std::move(cache_value_));
+                cache_ = nullptr;
+            }
         }
+
+        // a filter which holds on to its input, such as
+        // one compressing blocks in parallel, may need
+        // more input before producing any output
+        if( !filter_ ||
+            filter_done_ ||
+            !is_header_done_ ||
+            num_written > 0 ||
+            output.size() > 0 ||
+            would_block )
+            break;
+    }
+
+    if( hold_output() )
+    {
+        if( st_ == style::stream )
+            BOOST_HTTP_PROTO_RETURN_EC(
+                error::need_data);
+        BOOST_HTTP_PROTO_RETURN_EC(
+            error::would_block);
     }
 
+    if( would_block &&
+        is_header_done_ &&
+        output.size() == 0 )
+        BOOST_HTTP_PROTO_RETURN_EC(
+            error::would_block);
+
     // end:
     std::size_t n = 0;
     if( !is_header_done_ )
@@ -384,7 +959,7 @@ prepare() ->
     }
     else
     {
-        if( has_avail_out )
+        if( has_avail_out && num_written > 0 )
         {
             write_chunk_header(
                 chunk_header_, num_written);
@@ -398,7 +973,11 @@ prepare() ->
 
         if( (filter_ && filter_done_) ||
             (!filter_ && !more_) )
+        {
             prepped_[n++] = last_chunk_;
+            prepped_[n++] = trailer_;
+            last_chunk_out_ = true;
+        }
     }
 
     auto cbs = const_buffers_type(
@@ -425,6 +1004,18 @@ consume(
             detail::throw_invalid_argument();
     }
 
+    if( record_left_ > 0 )
+        record_left_ -= (std::min)(
+            n, record_left_);
+
+    if( batch_size_ > 0 )
+    {
+        batch_sent_ += n;
+        while( batch_done_ < batch_size_ &&
+            batch_ends_[batch_done_] <= batch_sent_ )
+            ++batch_done_;
+    }
+
     if( !is_header_done_ )
     {
         // consume header
@@ -438,6 +1029,42 @@ consume(
         is_header_done_ = true;
     }
 
+    if( st_ == style::region )
+    {
+        if( buffers::buffer_size(prepped_) > 0 )
+        {
+            prepped_.consume(n);
+        }
+        else if( n > 0 )
+        {
+            // Precondition violation
+            if( n > region_.size )
+                detail::throw_invalid_argument();
+
+            region_.offset += n;
+            region_.size -= n;
+            if( region_.size == 0 &&
+                parts_ > 0 )
+            {
+                // next part of a
+                // multipart/byteranges body
+                prepped_ = detail::array_of_const_buffers(
+                    part_pre_++, 1);
+                region_ = *part_region_++;
+                --parts_;
+            }
+            else if( region_.size == 0 )
+            {
+                prepped_ = region_post_;
+                more_ = false;
+            }
+        }
+        is_done_ =
+            region_.size == 0 &&
+            buffers::buffer_size(prepped_) == 0;
+        return;
+    }
+
     prepped_.consume(n);
     if( out_ )
     {
@@ -449,6 +1076,14 @@ consume(
     if( st_ == style::buffers && !filter_ && is_empty )
         more_ = false;
 
+    if( st_ == style::view && !filter_ && is_empty )
+    {
+        // all the output referring
+        // to the view was consumed
+        vsrc_->consume(view_.size());
+        view_ = {};
+    }
+
     if( st_ == style::empty &&
         is_empty &&
         !is_expect_continue_ )
@@ -458,6 +1093,18 @@ consume(
         is_done_ = filter_ ? filter_done_ : !more_;
 }
 
+file_region
+serializer::
+region() const noexcept
+{
+    if( st_ != style::region ||
+        !is_header_done_ ||
+        is_expect_continue_ ||
+        buffers::buffer_size(prepped_) > 0 )
+        return {};
+    return region_;
+}
+
 void
 serializer::
 use_deflate_encoding()
@@ -467,6 +1114,7 @@ use_deflate_encoding()
         detail::throw_logic_error();
 
     is_compressed_ = true;
+    coding_ = encoding::deflate;
     filter_ = &ws_.emplace<deflator_filter>(ctx_, ws_, false);
 }
 
@@ -479,70 +1127,324 @@ use_gzip_encoding()
         detail::throw_logic_error();
 
     is_compressed_ = true;
+    coding_ = encoding::gzip;
     filter_ = &ws_.emplace<deflator_filter>(ctx_, ws_, true);
 }
 
-//------------------------------------------------
-
 void
 serializer::
-copy(
-    buffers::const_buffer* dest,
-    buffers::const_buffer const* src,
-    std::size_t n) noexcept
+use_deflate_encoding(
+    parallel_options const& opt)
 {
-    while(n--)
-        *dest++ = *src++;
+    // can only apply one encoding
+    if(filter_)
+        detail::throw_logic_error();
+
+    is_compressed_ = true;
+    coding_ = encoding::deflate;
+    filter_ = &ws_.emplace<detail::parallel_deflator>(
+        ctx_, false, opt.block_size, opt.max_blocks);
 }
 
 void
 serializer::
-start_init(
-    message_view_base const& m)
+use_gzip_encoding(
+    parallel_options const& opt)
 {
-    // VFALCO what do we do with
-    // metadata error code failures?
-    // m.ph_->md.maybe_throw();
-
-    auto const& md = m.metadata();
-
-    is_done_ = false;
-    is_header_done_ = false;
-    is_expect_continue_ = md.expect.is_100_continue;
-
-    // Transfer-Encoding
-    {
-        auto const& te = md.transfer_encoding;
-        is_chunked_ = te.is_chunked;
-    }
+    // can only apply one encoding
+    if(filter_)
+        detail::throw_logic_error();
 
-    if( is_chunked_)
-    {
-        auto* p = ws_.reserve_front(chunked_overhead_);
-        chunk_header_ =
-            buffers::mutable_buffer(p, chunk_header_len_);
-        chunk_close_ =
-            buffers::mutable_buffer(
-                p + chunk_header_len_, crlf_len_);
-        last_chunk_ =
-            buffers::mutable_buffer(
-                p + chunk_header_len_ + crlf_len_,
-                last_chunk_len_);
+    is_compressed_ = true;
+    coding_ = encoding::gzip;
+    filter_ = &ws_.emplace<detail::parallel_deflator>(
+        ctx_, true, opt.block_size, opt.max_blocks);
+}
 
-        buffers::buffer_copy(
-            chunk_close_, buffers::const_buffer("\r\n", 2));
-        buffers::buffer_copy(
-            last_chunk_,
-            buffers::const_buffer("0\r\n\r\n", 5));
-    }
+void
+serializer::
+skip_incompressible(
+    std::size_t sample_size)
+{
+    sample_size_ = sample_size;
 }
 
 void
 serializer::
-start_empty(
-    message_view_base const& m)
+compute_digest(
+    digest_algorithm alg)
 {
-    start_init(m);
+    // can only compute one digest
+    if( digester_ )
+        detail::throw_logic_error();
+
+    if( alg == digest_algorithm::none )
+        return;
+    digester_ = &ws_.emplace<
+        detail::digester>(alg);
+}
+
+digest
+serializer::
+body_digest() const noexcept
+{
+    if( !digester_ )
+        return {};
+    return digester_->result();
+}
+
+void
+serializer::
+set_trailer(
+    fields_view_base const& trailer)
+{
+    // Precondition violation
+    if( !is_chunked_ ||
+        is_done_ ||
+        last_chunk_out_ ||
+        batch_size_ > 0 )
+        detail::throw_logic_error();
+
+    // the fields end with the CRLF which
+    // terminates the chunked body, so the
+    // last chunk is only "0\r\n"
+    auto const& h = *trailer.ph_;
+    trailer_ = buffers::const_buffer(
+        h.cbuf + h.prefix, h.size - h.prefix);
+    last_chunk_ = buffers::mutable_buffer(
+        last_chunk_.data(), 1 + crlf_len_);
+    if( last_slot_ )
+    {
+        last_slot_[0] = last_chunk_;
+        last_slot_[1] = trailer_;
+    }
+}
+
+void
+serializer::
+coalesce_output(
+    coalesce_options const& opt)
+{
+    min_output_ = opt.min_size;
+    max_hold_ = opt.max_hold;
+}
+
+void
+serializer::
+flush() noexcept
+{
+    flush_ = true;
+}
+
+void
+serializer::
+shape_records(
+    record_options const& opt)
+{
+    record_size_ = opt.size;
+    first_record_ = opt.first_size;
+    if( first_record_ == 0 ||
+        first_record_ > record_size_ )
+        first_record_ = record_size_;
+}
+
+//------------------------------------------------
+
+// Reserve the staging area for merged records,
+// which is skipped for an empty body or a file
+// region since their output is not merged
+void
+serializer::
+reserve_stage()
+{
+    if( record_size_ > 0 )
+        stage_ = buffers::mutable_buffer(
+            ws_.reserve_front(record_size_),
+            record_size_);
+}
+
+// Limit the output to the rest of the
+// current record, merging buffers so
+// that the record is written at once
+auto
+serializer::
+shape_output(
+    const_buffers_type cbs) noexcept ->
+        const_buffers_type
+{
+    if( record_left_ == 0 )
+        record_left_ = record_size_;
+
+    auto it = cbs.begin();
+    auto const end = cbs.end();
+    while( it != end && it->size() == 0 )
+        ++it;
+    if( it == end )
+        return cbs;
+
+    std::size_t n = 0;
+    for(auto p = it; p != end; ++p)
+    {
+        n += p->size();
+        if( n >= record_left_ )
+        {
+            n = record_left_;
+            break;
+        }
+    }
+    if( stage_.size() == 0 )
+        n = (std::min)(n, it->size());
+    if( n <= it->size() )
+    {
+        // nothing to merge
+        shaped_ = buffers::const_buffer(
+            it->data(), n);
+        return const_buffers_type(&shaped_, 1);
+    }
+
+    buffers::buffer_copy(
+        buffers::mutable_buffer(
+            stage_.data(), n),
+        cbs);
+    shaped_ = buffers::const_buffer(
+        stage_.data(), n);
+    return const_buffers_type(&shaped_, 1);
+}
+
+// Return true if the buffered body
+// output is too small to send yet
+bool
+serializer::
+hold_output() noexcept
+{
+    if( filter_ ||
+        min_output_ == 0 ||
+        !more_ ||
+        (is_sse_ && !is_header_done_) ||
+        (st_ != style::source &&
+            st_ != style::stream) ||
+        in_->size() >= min_output_ ||
+        in_->capacity() == 0 ||
+        flush_ )
+    {
+        is_holding_ = false;
+        flush_ = false;
+        return false;
+    }
+
+    auto const now =
+        std::chrono::steady_clock::now();
+    if( !is_holding_ )
+    {
+        is_holding_ = true;
+        hold_start_ = now;
+        return true;
+    }
+    if( max_hold_ > max_hold_.zero() &&
+        now - hold_start_ >= max_hold_ )
+    {
+        is_holding_ = false;
+        return false;
+    }
+    return true;
+}
+
+void
+serializer::
+copy(
+    buffers::const_buffer* dest,
+    buffers::const_buffer const* src,
+    std::size_t n) noexcept
+{
+    while(n--)
+        *dest++ = *src++;
+}
+
+void
+serializer::
+start_init(
+    message_view_base const& m)
+{
+    // VFALCO what do we do with
+    // metadata error code failures?
+    // m.ph_->md.maybe_throw();
+
+    auto const& md = m.metadata();
+
+    is_done_ = false;
+    is_header_done_ = false;
+    is_expect_continue_ = md.expect.is_100_continue;
+
+    batch_ends_ = nullptr;
+    batch_size_ = 0;
+    batch_cap_ = 0;
+    batch_done_ = 0;
+    batch_sent_ = 0;
+    batch_last_ = nullptr;
+    is_holding_ = false;
+    flush_ = false;
+    is_msg_end_ = false;
+    trailer_ = {};
+    last_slot_ = nullptr;
+    last_chunk_out_ = false;
+    is_sse_ = false;
+
+    // the staging area is reserved by
+    // the styles which can merge output
+    record_left_ = first_record_;
+    stage_ = {};
+
+    hdr_ = { m.ph_->cbuf, m.ph_->size };
+    hdr_identity_ = hdr_;
+
+    // the header waits for a sample of the body,
+    // unless it must be sent first
+    is_sampling_ =
+        filter_ &&
+        sample_size_ > 0 &&
+        !is_expect_continue_;
+    if( is_sampling_ &&
+        md.content_encoding.count > 0 )
+    {
+        auto* p = reinterpret_cast<char*>(
+            ws_.reserve_front(m.ph_->size));
+        hdr_identity_ = { p,
+            copy_without_content_encoding(*m.ph_, p) };
+    }
+
+    // Transfer-Encoding
+    {
+        auto const& te = md.transfer_encoding;
+        is_chunked_ = te.is_chunked;
+    }
+
+    if( is_chunked_)
+    {
+        auto* p = ws_.reserve_front(chunked_overhead_);
+        chunk_header_ =
+            buffers::mutable_buffer(p, chunk_header_len_);
+        chunk_close_ =
+            buffers::mutable_buffer(
+                p + chunk_header_len_, crlf_len_);
+        last_chunk_ =
+            buffers::mutable_buffer(
+                p + chunk_header_len_ + crlf_len_,
+                last_chunk_len_);
+
+        buffers::buffer_copy(
+            chunk_close_, buffers::const_buffer("\r\n", 2));
+        buffers::buffer_copy(
+            last_chunk_,
+            buffers::const_buffer("0\r\n\r\n", 5));
+    }
+}
+
+void
+serializer::
+start_empty(
+    message_view_base const& m)
+{
+    start_init(m);
 
     st_ = style::empty;
     more_ = true;
@@ -556,23 +1458,14 @@ start_empty(
     {
         prepped_ = make_array(
             1 + // header
-            1); // final chunk
-
-        // Buffer is too small
-        if(ws_.size() < 5)
-            detail::throw_length_error();
-
-        buffers::mutable_buffer dest(
-            ws_.data(), 5);
-        buffers::buffer_copy(
-            dest,
-            buffers::const_buffer(
-                "0\r\n\r\n", 5));
-        prepped_[1] = dest;
+            1 + // final chunk
+            1); // trailer
+        last_slot_ = &prepped_[1];
+        last_slot_[0] = last_chunk_;
     }
 
     hp_ = &prepped_[0];
-    *hp_ = { m.ph_->cbuf, m.ph_->size };
+    *hp_ = hdr_;
 }
 
 void
@@ -580,9 +1473,66 @@ serializer::
 start_buffers(
     message_view_base const& m)
 {
+    reserve_stage();
     st_ = style::buffers;
     tmp1_ = {};
 
+    if( is_sampling_ )
+    {
+        is_sampling_ = false;
+        if(! is_compressible(buf_, sample_size_) )
+        {
+            filter_ = nullptr;
+            coding_ = encoding::identity;
+            hdr_ = hdr_identity_;
+        }
+    }
+
+    if( filter_ )
+    {
+        auto* cache = ctx_.find_service<
+            compression_cache>();
+        if( cache )
+        {
+            buffers::const_buffer_span body(
+                buf_.data(), buf_.size());
+            cached_ = cache->find(
+                body, coding_, deflator_level);
+            if( cached_ )
+            {
+                // serve the stored output, the
+                // compressor is never invoked
+                filter_ = nullptr;
+                buf_ = make_array(1);
+                buf_[0] = buffers::const_buffer(
+                    cached_->data(), cached_->size());
+            }
+            else if( buffers::buffer_size(body) <=
+                cache->get_config().max_body_size )
+            {
+                // keep the body to store the
+                // output once compression finishes
+                cache_ = cache;
+                cache_body_ = make_array(buf_.size());
+                copy(
+                    cache_body_.data(),
+                    buf_.data(),
+                    buf_.size());
+
+                // the output is appended to the
+                // value which the cache will own
+                cache_value_ =
+                    std::make_shared<std::string>();
+            }
+        }
+    }
+
+    // the body is hashed once, here,
+    // unless the filter produces it
+    if( digester_ && !filter_ )
+        digester_->update_buffers(
+            buf_, buffers::buffer_size(buf_));
+
     if( !filter_ && !is_chunked_ )
     {
         prepped_ = make_array(
@@ -590,7 +1540,7 @@ start_buffers(
             buf_.size()); // user input
 
         hp_ = &prepped_[0];
-        *hp_ = { m.ph_->cbuf, m.ph_->size };
+        *hp_ = hdr_;
 
         copy(&prepped_[1], buf_.data(), buf_.size());
 
@@ -604,11 +1554,13 @@ start_buffers(
         {
             prepped_ = make_array(
                 1 +           // header
-                1);           // last chunk
+                1 +           // last chunk
+                1);           // trailer
 
             hp_ = &prepped_[0];
-            *hp_ = { m.ph_->cbuf, m.ph_->size };
-            prepped_[1] = last_chunk_;
+            *hp_ = hdr_;
+            last_slot_ = &prepped_[1];
+            last_slot_[0] = last_chunk_;
             more_ = false;
             return;
         }
@@ -621,15 +1573,17 @@ start_buffers(
             1 +           // chunk header
             buf_.size() + // user input
             1 +           // chunk close
-            1);           // last chunk
+            1 +           // last chunk
+            1);           // trailer
 
         hp_ = &prepped_[0];
-        *hp_ = { m.ph_->cbuf, m.ph_->size };
+        *hp_ = hdr_;
         prepped_[1] = chunk_header_;
         copy(&prepped_[2], buf_.data(), buf_.size());
 
-        prepped_[prepped_.size() - 2] = chunk_close_;
-        prepped_[prepped_.size() - 1] = last_chunk_;
+        prepped_[prepped_.size() - 3] = chunk_close_;
+        last_slot_ = &prepped_[prepped_.size() - 2];
+        last_slot_[0] = last_chunk_;
         more_ = true;
         return;
     }
@@ -641,7 +1595,8 @@ start_buffers(
             1 + // chunk header
             2 + // tmp
             1 + // chunk close
-            1); // last chunk
+            1 + // last chunk
+            1); // trailer
     }
     else
         prepped_ = make_array(
@@ -649,7 +1604,7 @@ start_buffers(
             2); // tmp
 
     hp_ = &prepped_[0];
-    *hp_ = { m.ph_->cbuf, m.ph_->size };
+    *hp_ = hdr_;
     tmp0_ = { ws_.data(), ws_.size() };
     out_ = &tmp0_;
     in_ = out_;
@@ -662,6 +1617,7 @@ start_source(
     message_view_base const& m,
     source* src)
 {
+    reserve_stage();
     st_ = style::source;
     src_ = src;
 
@@ -672,7 +1628,8 @@ start_source(
             1 + // chunk header
             2 + // tmp
             1 + // chunk close
-            1); // last chunk
+            1 + // last chunk
+            1); // trailer
     }
     else
         prepped_ = make_array(
@@ -703,10 +1660,513 @@ start_source(
     }
 
     hp_ = &prepped_[0];
-    *hp_ = { m.ph_->cbuf, m.ph_->size };
+    *hp_ = hdr_;
+    more_ = true;
+}
+
+void
+serializer::
+start_view_impl(
+    message_view_base const& m,
+    view_source* src)
+{
+    reserve_stage();
+    st_ = style::view;
+    vsrc_ = src;
+    view_ = {};
+
+    if( is_chunked_ )
+    {
+        prepped_ = make_array(
+            1 + // header
+            1 + // chunk header
+            2 + // view or tmp
+            1 + // chunk close
+            1 + // last chunk
+            1); // trailer
+    }
+    else
+        prepped_ = make_array(
+            1 + // header
+            2); // view or tmp
+
+    if( !filter_ )
+    {
+        // nothing is buffered
+        in_ = nullptr;
+        out_ = nullptr;
+    }
+    else
+    {
+        // the filter reads from the
+        // view, only output is buffered
+        tmp0_ = { ws_.data(), ws_.size() };
+        if( tmp0_.capacity() < 1 )
+            detail::throw_length_error();
+
+        in_ = &tmp0_;
+        out_ = &tmp0_;
+    }
+
+    hp_ = &prepped_[0];
+    *hp_ = hdr_;
+    more_ = true;
+}
+
+void
+serializer::
+start_compressed_impl(
+    message_base& m,
+    buffers::mutable_buffer dest)
+{
+    // an encoding must be applied, and
+    // the body cannot be chunked
+    if( !filter_ ||
+        m.metadata().transfer_encoding.is_chunked )
+        detail::throw_logic_error();
+
+    // an incompressible body is sent as-is,
+    // without the Content-Encoding fields
+    if( sample_size_ > 0 &&
+        !m.metadata().expect.is_100_continue &&
+        !is_compressible(buf_, sample_size_) )
+    {
+        m.set_payload_size(
+            buffers::buffer_size(buf_));
+        start_init(m);
+        BOOST_ASSERT(is_sampling_);
+        is_sampling_ = false;
+        filter_ = nullptr;
+        coding_ = encoding::identity;
+        hdr_ = hdr_identity_;
+        start_buffers(m);
+        return;
+    }
+
+    auto* cache = ctx_.find_service<
+        compression_cache>();
+    buffers::const_buffer_span body(
+        buf_.data(), buf_.size());
+    if( cache )
+        cached_ = cache->find(
+            body, coding_, deflator_level);
+
+    buffers::const_buffer out;
+    if( cached_ )
+    {
+        out = buffers::const_buffer(
+            cached_->data(), cached_->size());
+    }
+    else
+    {
+        // use the free space in the workspace,
+        // leaving the last byte which can
+        // never be reserved.
+        bool const in_ws = (dest.size() == 0);
+        if( in_ws )
+        {
+            if( ws_.size() < 2 )
+                detail::throw_length_error();
+            dest = { ws_.data(), ws_.size() - 1 };
+        }
+
+        detail::filter::results rs;
+        if( buffers::buffer_size(buf_) == 0 )
+            rs = filter_->process(
+                dest, buffers::const_buffer(), false);
+        else
+            rs = filter_->process(dest, buf_, false);
+
+        if( rs.ec.failed() )
+            detail::throw_system_error(rs.ec);
+
+        // compressed output must fit entirely
+        if( !rs.finished )
+            detail::throw_length_error();
+
+        if( in_ws )
+            ws_.reserve_front(rs.out_bytes);
+
+        out = buffers::const_buffer(
+            dest.data(), rs.out_bytes);
+
+        if( cache )
+            cache->insert(
+                body,
+                coding_,
+                deflator_level,
+                core::string_view(
+                    static_cast<char const*>(out.data()),
+                    out.size()));
+    }
+    auto const n = out.size();
+
+    // the filter is exhausted, the body
+    // is now sent as plain buffers
+    filter_ = nullptr;
+    filter_done_ = true;
+    if( digester_ )
+        digester_->update(
+            out.data(), out.size());
+
+    m.set_payload_size(n);
+    start_init(m);
+    reserve_stage();
+
+    st_ = style::buffers;
+    tmp1_ = {};
+    buf_ = {};
+    prepped_ = make_array(
+        1 + // header
+        1); // compressed body
+
+    hp_ = &prepped_[0];
+    *hp_ = hdr_;
+    prepped_[1] = out;
+    more_ = (n > 0);
+}
+
+void
+serializer::
+start(
+    message_view_base const& m,
+    file_region const& r)
+{
+    // the body is never read, so it
+    // cannot be encoded or hashed
+    if( filter_ || digester_ )
+        detail::throw_logic_error();
+
+    start_init(m);
+
+    st_ = style::region;
+    region_ = r;
+    region_post_ = {};
+    if( !is_chunked_ )
+    {
+        prepped_ = make_array(
+            1); // header
+    }
+    else if( r.size == 0 )
+    {
+        prepped_ = make_array(
+            1 + // header
+            1 + // last chunk
+            1); // trailer
+        last_slot_ = &prepped_[1];
+        last_slot_[0] = last_chunk_;
+    }
+    else
+    {
+        write_chunk_header(
+            chunk_header_, r.size);
+
+        prepped_ = make_array(
+            1 + // header
+            1); // chunk header
+        prepped_[1] = chunk_header_;
+
+        region_post_ = make_array(
+            1 + // chunk close
+            1 + // last chunk
+            1); // trailer
+        region_post_[0] = chunk_close_;
+        last_slot_ = &region_post_[1];
+        last_slot_[0] = last_chunk_;
+    }
+
+    hp_ = &prepped_[0];
+    *hp_ = hdr_;
+    more_ = (r.size > 0);
+}
+
+void
+serializer::
+start_ranges(
+    response& res,
+    file_region const& file,
+    byte_range const* ranges,
+    std::size_t n)
+{
+    // the body is never read, so it
+    // cannot be encoded or hashed
+    if( filter_ || digester_ )
+        detail::throw_logic_error();
+
+    // a range is sent as-is
+    res.erase(field::transfer_encoding);
+
+    // "bytes first-last/length"
+    char cr[6 + 20 + 1 + 20 + 1 + 20];
+    if( n == 0 )
+    {
+        detail::number_string const len(file.size);
+        std::memcpy(cr, "bytes */", 8);
+        std::memcpy(cr + 8, len.data(), len.size());
+        res.set_start_line(
+            status::range_not_satisfiable,
+            res.version());
+        res.set(field::content_range,
+            core::string_view(cr, 8 + len.size()));
+        res.set_payload_size(0);
+        start(res, file_region{ file.handle, 0, 0 });
+        return;
+    }
+
+    if( n == 1 )
+    {
+        auto const end = write_content_range(
+            cr, ranges[0], file.size);
+        res.set_start_line(
+            status::partial_content,
+            res.version());
+        res.set(field::content_range,
+            core::string_view(cr, end - cr));
+        res.set_payload_size(ranges[0].size);
+        start(res, file_region{
+            file.handle,
+            file.offset + ranges[0].offset,
+            ranges[0].size });
+        return;
+    }
+
+    // multipart/byteranges
+    //
+    // the framing of all the parts is written
+    // into the workspace while the Content-Type
+    // of res is still valid, and its size adds
+    // to the Content-Length of the payload
+
+    char ct[31 + boundary_size];
+    std::memcpy(ct,
+        "multipart/byteranges; boundary=", 31);
+    char* const boundary = ct + 31;
+    make_boundary(boundary,
+        this, file.offset ^ file.size);
+
+    auto const type =
+        res.value_or(field::content_type, "");
+    std::size_t const part_size =
+        2 + boundary_size + 2 + // dash-boundary CRLF
+        (type.empty() ? 0 : 14 + type.size() + 2) +
+        15 + 4; // Content-Range, CRLF CRLF
+    std::size_t size =
+        2 * (n - 1) + // CRLF before each delimiter
+        4 + boundary_size + 4; // close-delimiter
+    std::uint64_t payload = 0;
+    for(std::size_t i = 0; i < n; ++i)
+    {
+        size += part_size + content_range_size(
+            ranges[i], file.size);
+        payload += ranges[i].size;
+    }
+    payload += size;
+
+    auto* d = reinterpret_cast<char*>(
+        ws_.reserve_front(size));
+    auto const put =
+        [&d](char const* s, std::size_t len)
+        {
+            std::memcpy(d, s, len);
+            d += len;
+        };
+
+    // the framing of each part
+    auto* pre = ws_.push_array(
+        n, buffers::const_buffer{});
+    for(std::size_t i = 0; i < n; ++i)
+    {
+        auto* const p = d;
+        if( i > 0 )
+            put("\r\n", 2);
+        put("--", 2);
+        put(boundary, boundary_size);
+        put("\r\n", 2);
+        if(! type.empty() )
+        {
+            put("Content-Type: ", 14);
+            put(type.data(), type.size());
+            put("\r\n", 2);
+        }
+        put("Content-Range: ", 15);
+        d = write_content_range(
+            d, ranges[i], file.size);
+        put("\r\n\r\n", 4);
+        pre[i] = buffers::const_buffer(p, d - p);
+    }
+    auto* const close = d;
+    put("\r\n--", 4);
+    put(boundary, boundary_size);
+    put("--\r\n", 4);
+    BOOST_ASSERT(static_cast<std::size_t>(
+        d - close) == 4 + boundary_size + 4);
+
+    res.set_start_line(
+        status::partial_content,
+        res.version());
+    res.set(field::content_type,
+        core::string_view(ct, sizeof(ct)));
+    res.set_payload_size(payload);
+
+    start_init(res);
+    BOOST_ASSERT(! is_chunked_);
+
+    st_ = style::region;
+    auto* rgn = ws_.push_array(
+        n - 1, file_region{});
+    for(std::size_t i = 1; i < n; ++i)
+        rgn[i - 1] = file_region{
+            file.handle,
+            file.offset + ranges[i].offset,
+            ranges[i].size };
+    part_pre_ = pre + 1;
+    part_region_ = rgn;
+    parts_ = n - 1;
+
+    prepped_ = make_array(
+        1 + // header
+        1); // first part header
+    prepped_[1] = pre[0];
+
+    region_ = file_region{
+        file.handle,
+        file.offset + ranges[0].offset,
+        ranges[0].size };
+    region_post_ = make_array(
+        1); // close-delimiter
+    region_post_[0] = buffers::const_buffer(
+        close, d - close);
+
+    hp_ = &prepped_[0];
+    *hp_ = hdr_;
     more_ = true;
 }
 
+auto
+serializer::
+append_impl(
+    message_view_base const& m,
+    std::size_t n,
+    std::size_t size) ->
+        buffers::const_buffer*
+{
+    // Precondition violation
+    if( is_done_ ||
+        filter_ ||
+        is_expect_continue_ ||
+        (st_ != style::empty &&
+            st_ != style::buffers) )
+        detail::throw_logic_error();
+
+    auto const& md = m.metadata();
+    bool const chunked =
+        md.transfer_encoding.is_chunked;
+
+    // the first message may have been empty
+    if( stage_.size() == 0 )
+        reserve_stage();
+
+    // header, body, and any framing
+    std::size_t k = 1 + n;
+    std::size_t bytes = m.ph_->size + size;
+    char* framing = nullptr;
+    if( chunked )
+    {
+        if( size > 0 )
+        {
+            framing = reinterpret_cast<char*>(
+                ws_.reserve_front(chunked_overhead_));
+            k += 3;
+            bytes += chunked_overhead_;
+        }
+        else
+        {
+            k += 1;
+            bytes += last_chunk_len_;
+        }
+    }
+
+    // grow the arrays geometrically, the
+    // workspace cannot free the old ones
+    auto const count = batch_size_ > 0 ?
+        batch_size_ + 1 : 2; // with the first
+    if( batch_cap_ < count )
+    {
+        auto const cap = 2 * count;
+        auto* p = ws_.push_array(
+            cap, std::uint64_t{});
+        if( batch_size_ > 0 )
+            std::memcpy(p, batch_ends_,
+                batch_size_ * sizeof(*p));
+        batch_ends_ = p;
+        batch_cap_ = cap;
+    }
+
+    auto const used = prepped_.size();
+    auto* end = prepped_.data() + used;
+    if( !batch_last_ ||
+        static_cast<std::size_t>(
+            batch_last_ - end) < k )
+    {
+        auto const cap = 2 * (used + k);
+        auto* p = ws_.push_array(
+            cap, buffers::const_buffer{});
+        copy(p, prepped_.data(), used);
+        if( !is_header_done_ )
+            hp_ = p;
+        prepped_ = detail::array_of_const_buffers(
+            p, used);
+        end = p + used;
+        batch_last_ = p + cap;
+    }
+    if( batch_size_ == 0 )
+    {
+        // the first message
+        batch_ends_[batch_size_++] =
+            buffers::buffer_size(prepped_);
+        batch_done_ = 0;
+        batch_sent_ = 0;
+    }
+    prepped_ = detail::array_of_const_buffers(
+        prepped_.data(), used + k);
+    batch_ends_[batch_size_] =
+        batch_ends_[batch_size_ - 1] + bytes;
+    ++batch_size_;
+
+    *end++ = buffers::const_buffer(
+        m.ph_->cbuf, m.ph_->size);
+    if( !chunked )
+        return end;
+    if( size == 0 )
+    {
+        *end = buffers::const_buffer(
+            "0\r\n\r\n", last_chunk_len_);
+        return end;
+    }
+
+    buffers::mutable_buffer ch(
+        framing, chunk_header_len_);
+    write_chunk_header(ch, size);
+    std::memcpy(framing + chunk_header_len_,
+        "\r\n0\r\n\r\n", crlf_len_ + last_chunk_len_);
+    end[0] = ch;
+    end[1 + n] = buffers::const_buffer(
+        framing + chunk_header_len_, crlf_len_);
+    end[2 + n] = buffers::const_buffer(
+        framing + chunk_header_len_ + crlf_len_,
+        last_chunk_len_);
+    return end + 1;
+}
+
+std::size_t
+serializer::
+pending() const noexcept
+{
+    if( batch_size_ == 0 )
+        return is_done_ ? 0 : 1;
+    return batch_size_ - batch_done_;
+}
+
 auto
 serializer::
 start_stream(
@@ -714,6 +2174,7 @@ start_stream(
         stream
 {
     start_init(m);
+    reserve_stage();
 
     st_ = style::stream;
     if( is_chunked_ )
@@ -723,7 +2184,8 @@ start_stream(
             1 + // chunk header
             2 + // tmp
             1 + // chunk close
-            1); // last chunk
+            1 + // last chunk
+            1); // trailer
     }
     else
         prepped_ = make_array(
@@ -754,11 +2216,39 @@ start_stream(
     }
 
     hp_ = &prepped_[0];
-    *hp_ = { m.ph_->cbuf, m.ph_->size };
+    *hp_ = hdr_;
     more_ = true;
     return stream{*this};
 }
 
+auto
+serializer::
+start_shared_stream(
+    message_view_base const& m) ->
+        shared_stream
+{
+    start_init(m);
+    auto& ring = ws_.emplace<
+        detail::spsc_ring>();
+    start_view_impl(m, &ring);
+
+    // with a filter, the rest of the
+    // space holds its output
+    if( ws_.size() < 2 )
+        detail::throw_length_error();
+    auto n = ws_.size() - 1;
+    if( filter_ )
+        n = ws_.size() / 2;
+    ring.reset(ws_.reserve_front(n), n);
+    if( filter_ )
+    {
+        tmp0_ = { ws_.data(), ws_.size() };
+        if( tmp0_.capacity() < 1 )
+            detail::throw_length_error();
+    }
+    return shared_stream{ring};
+}
+
 //------------------------------------------------
 
 std::size_t
@@ -804,6 +2294,9 @@ commit(std::size_t n) const
     if( n == 0 )
         detail::throw_logic_error();
 
+    if( sr_->digester_ && !sr_->filter_ )
+        sr_->digester_->update_buffers(
+            sr_->in_->prepare(n), n);
     sr_->in_->commit(n);
 }
 
@@ -818,6 +2311,185 @@ close() const
     sr_->more_ = false;
 }
 
+void
+serializer::
+stream::
+close(fields_view_base const& trailer) const
+{
+    // Precondition violation
+    if(! sr_->more_ )
+        detail::throw_logic_error();
+    sr_->set_trailer(trailer);
+    sr_->more_ = false;
+}
+
+//------------------------------------------------
+
+void
+serializer::
+shared_stream::
+set_handler(handler* h) const noexcept
+{
+    r_->set_handler(h);
+}
+
+auto
+serializer::
+shared_stream::
+prepare() const noexcept ->
+    buffers_type
+{
+    return r_->prepare();
+}
+
+void
+serializer::
+shared_stream::
+commit(std::size_t n) const
+{
+    r_->commit(n);
+}
+
+void
+serializer::
+shared_stream::
+close() const
+{
+    r_->close();
+}
+
+//------------------------------------------------
+
+auto
+serializer::
+start_sse(
+    message_view_base const& m,
+    sse_options const& opt) ->
+        sse_stream
+{
+    // a compressor holds on to its
+    // input, delaying the events
+    if( filter_ )
+        detail::throw_logic_error();
+
+    start_stream(m);
+    is_sse_ = true;
+    if( opt.max_latency > opt.max_latency.zero() )
+    {
+        min_output_ = opt.batch_size;
+        max_hold_ = opt.max_latency;
+    }
+    else
+    {
+        min_output_ = 0;
+    }
+    return sse_stream(*this);
+}
+
+bool
+serializer::
+sse_stream::
+write(sse_event const& ev) const
+{
+    // Precondition violation
+    if(! sr_->more_ )
+        detail::throw_logic_error();
+
+    // a line break would end the field
+    if( has_line_break(ev.event) ||
+        has_line_break(ev.id) )
+        detail::throw_invalid_argument();
+
+    // event: <type> LF
+    // id: <id> LF
+    // data: <line> LF, for each line
+    // LF
+    std::size_t n = 1;
+    if(! ev.event.empty() )
+        n += 8 + ev.event.size();
+    if(! ev.id.empty() )
+        n += 5 + ev.id.size();
+    for_each_line(ev.data,
+        [&n](core::string_view line)
+        {
+            n += 7 + line.size();
+        });
+
+    auto& in = *sr_->in_;
+    if( n > in.size() + in.capacity() )
+        detail::throw_length_error();
+    if( n > in.capacity() )
+        return false;
+
+    sse_writer w(in.prepare(n));
+    if(! ev.event.empty() )
+    {
+        w.append("event: ");
+        w.append(ev.event);
+        w.append("\n");
+    }
+    if(! ev.id.empty() )
+    {
+        w.append("id: ");
+        w.append(ev.id);
+        w.append("\n");
+    }
+    for_each_line(ev.data,
+        [&w](core::string_view line)
+        {
+            w.append("data: ");
+            w.append(line);
+            w.append("\n");
+        });
+    w.append("\n");
+    commit(n);
+    return true;
+}
+
+bool
+serializer::
+sse_stream::
+ping() const
+{
+    // Precondition violation
+    if(! sr_->more_ )
+        detail::throw_logic_error();
+
+    // a comment, which clients ignore
+    core::string_view const s = ":\n\n";
+    auto& in = *sr_->in_;
+    if( in.capacity() < s.size() )
+        return false;
+    sse_writer(in.prepare(s.size())).append(s);
+    commit(s.size());
+
+    // sent even while events are held
+    sr_->flush_ = true;
+    return true;
+}
+
+void
+serializer::
+sse_stream::
+close() const
+{
+    // Precondition violation
+    if(! sr_->more_ )
+        detail::throw_logic_error();
+    sr_->more_ = false;
+}
+
+void
+serializer::
+sse_stream::
+commit(std::size_t n) const
+{
+    if( sr_->digester_ )
+        sr_->digester_->update_buffers(
+            sr_->in_->prepare(n), n);
+    sr_->in_->commit(n);
+}
+
 //------------------------------------------------
 
 } // http_proto
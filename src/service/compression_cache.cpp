@@ -0,0 +1,284 @@
+//
+// Copyright (c) 2026 agent (agent@local)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/cppalliance/http_proto
+//
+
+#include <boost/http_proto/service/compression_cache.hpp>
+#include <boost/http_proto/detail/except.hpp>
+#include <boost/buffers/buffer_size.hpp>
+
+#include <cstring>
+#include <iterator>
+#include <list>
+#include <mutex>
+#include <unordered_map>
+#include <utility>
+
+namespace boost {
+namespace http_proto {
+
+namespace {
+
+// 64-bit hash of the body octets, processed a
+// word at a time. Collisions are harmless since
+// the stored body is compared on lookup.
+std::uint64_t
+hash_body(
+    buffers::const_buffer_span body) noexcept
+{
+    std::uint64_t const m = 0x9e3779b97f4a7c15ULL;
+    std::uint64_t h = 0xcbf29ce484222325ULL;
+    for(buffers::const_buffer b : body)
+    {
+        auto p = static_cast<
+            unsigned char const*>(b.data());
+        auto n = b.size();
+        while(n >= 8)
+        {
+            std::uint64_t w;
+            std::memcpy(&w, p, 8);
+            h = (h ^ w) * m;
+            h ^= h >> 29;
+            p += 8;
+            n -= 8;
+        }
+        while(n--)
+            h = (h ^ *p++) * 0x100000001b3ULL;
+    }
+    return h ^ (h >> 32);
+}
+
+// Compare the body octets with a stored copy
+bool
+equal_body(
+    buffers::const_buffer_span body,
+    std::string const& s) noexcept
+{
+    auto p = s.data();
+    for(buffers::const_buffer b : body)
+    {
+        if(b.size() == 0)
+            continue;
+        if(std::memcmp(p, b.data(), b.size()) != 0)
+            return false;
+        p += b.size();
+    }
+    return true;
+}
+
+} // (anon)
+
+//------------------------------------------------
+
+struct compression_cache::impl
+{
+    struct entry
+    {
+        std::uint64_t hash;
+        encoding coding;
+        int level;
+        std::string body;
+        value_type value;
+    };
+
+    using list_type = std::list<entry>;
+
+    mutable std::mutex m;
+    list_type lru; // most recent first
+    std::unordered_multimap<
+        std::uint64_t,
+        list_type::iterator> index;
+    std::size_t size = 0;
+
+    list_type::iterator
+    lookup(
+        std::uint64_t hash,
+        buffers::const_buffer_span body,
+        std::size_t n,
+        encoding coding,
+        int level) noexcept
+    {
+        auto r = index.equal_range(hash);
+        for(auto it = r.first; it != r.second; ++it)
+        {
+            auto& e = *it->second;
+            if( e.coding == coding &&
+                e.level == level &&
+                e.body.size() == n &&
+                equal_body(body, e.body))
+                return it->second;
+        }
+        return lru.end();
+    }
+
+    void
+    erase(list_type::iterator pos) noexcept
+    {
+        auto r = index.equal_range(pos->hash);
+        for(auto it = r.first; it != r.second; ++it)
+        {
+            if(it->second == pos)
+            {
+                index.erase(it);
+                break;
+            }
+        }
+        size -= pos->body.size() + pos->value->size();
+        lru.erase(pos);
+    }
+};
+
+//------------------------------------------------
+
+compression_cache::
+compression_cache(
+    context&,
+    config const& cfg)
+    : cfg_(cfg)
+    , impl_(new impl)
+{
+}
+
+compression_cache::
+~compression_cache() = default;
+
+auto
+compression_cache::
+find(
+    buffers::const_buffer_span body,
+    encoding coding,
+    int level) ->
+        value_type
+{
+    auto const n = buffers::buffer_size(body);
+    if(n > cfg_.max_body_size)
+        return nullptr;
+
+    auto const hash = hash_body(body);
+
+    std::lock_guard<std::mutex> lock(impl_->m);
+    auto it = impl_->lookup(
+        hash, body, n, coding, level);
+    if(it == impl_->lru.end())
+        return nullptr;
+
+    // mark as most recently used
+    impl_->lru.splice(
+        impl_->lru.begin(), impl_->lru, it);
+    return it->value;
+}
+
+void
+compression_cache::
+insert(
+    buffers::const_buffer_span body,
+    encoding coding,
+    int level,
+    core::string_view compressed)
+{
+    // copy only what can be stored
+    auto const n = buffers::buffer_size(body);
+    if( n > cfg_.max_body_size ||
+        n + compressed.size() > cfg_.max_size )
+        return;
+
+    insert(body, coding, level,
+        std::make_shared<
+            std::string const>(compressed));
+}
+
+void
+compression_cache::
+insert(
+    buffers::const_buffer_span body,
+    encoding coding,
+    int level,
+    value_type compressed)
+{
+    if(! compressed)
+        detail::throw_invalid_argument();
+
+    auto const n = buffers::buffer_size(body);
+    if(n > cfg_.max_body_size)
+        return;
+
+    auto const bytes = n + compressed->size();
+    if(bytes > cfg_.max_size)
+        return;
+
+    auto const hash = hash_body(body);
+
+    // allocate outside the lock
+    impl::entry e;
+    e.hash = hash;
+    e.coding = coding;
+    e.level = level;
+    e.body.resize(n);
+    {
+        auto p = &e.body[0];
+        for(buffers::const_buffer b : body)
+        {
+            if(b.size() == 0)
+                continue;
+            std::memcpy(p, b.data(), b.size());
+            p += b.size();
+        }
+    }
+    e.value = std::move(compressed);
+
+    std::lock_guard<std::mutex> lock(impl_->m);
+    if(impl_->lookup(hash, body, n, coding, level) !=
+        impl_->lru.end())
+        return;
+
+    while(impl_->size + bytes > cfg_.max_size)
+        impl_->erase(std::prev(impl_->lru.end()));
+
+    impl_->lru.push_front(std::move(e));
+    impl_->index.emplace(hash, impl_->lru.begin());
+    impl_->size += bytes;
+}
+
+std::size_t
+compression_cache::
+size() const noexcept
+{
+    std::lock_guard<std::mutex> lock(impl_->m);
+    return impl_->size;
+}
+
+std::size_t
+compression_cache::
+count() const noexcept
+{
+    std::lock_guard<std::mutex> lock(impl_->m);
+    return impl_->lru.size();
+}
+
+void
+compression_cache::
+clear() noexcept
+{
+    std::lock_guard<std::mutex> lock(impl_->m);
+    impl_->index.clear();
+    impl_->lru.clear();
+    impl_->size = 0;
+}
+
+//------------------------------------------------
+
+compression_cache&
+install_compression_cache(
+    context& ctx,
+    compression_cache::config const& cfg)
+{
+    return ctx.make_service<
+        compression_cache>(cfg);
+}
+
+} // http_proto
+} // boost
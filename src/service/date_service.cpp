@@ -0,0 +1,200 @@
+//
+// Copyright (c) 2026 agent (agent@local)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/cppalliance/http_proto
+//
+
+#include <boost/http_proto/service/date_service.hpp>
+
+#include <cstring>
+
+namespace boost {
+namespace http_proto {
+
+namespace {
+
+void
+put2(char* p, unsigned v) noexcept
+{
+    p[0] = static_cast<char>('0' + v / 10);
+    p[1] = static_cast<char>('0' + v % 10);
+}
+
+} // (anon)
+
+constexpr std::size_t date_service::size;
+constexpr std::size_t date_service::words;
+
+date_service::
+date_service(context&) noexcept
+    : seq_(0)
+    , time_(0)
+{
+    char buf[words * 8] = {};
+    format(0, buf);
+    for(std::size_t i = 0; i < words; ++i)
+    {
+        std::uint64_t w;
+        std::memcpy(&w, buf + i * 8, 8);
+        buf_[i].store(w, std::memory_order_relaxed);
+    }
+}
+
+date_service::
+~date_service() = default;
+
+void
+date_service::
+copy(char* dest) noexcept
+{
+    copy(dest, std::time(nullptr));
+}
+
+void
+date_service::
+copy(
+    char* dest,
+    std::time_t now) noexcept
+{
+    // a caller which read the clock just before
+    // a second boundary keeps the newer date
+    if(time_.load(std::memory_order_relaxed) <
+            static_cast<std::int64_t>(now))
+        update(now);
+
+    char buf[words * 8];
+    for(;;)
+    {
+        auto const s0 =
+            seq_.load(std::memory_order_acquire);
+        if(s0 & 1)
+            continue;
+        for(std::size_t i = 0; i < words; ++i)
+        {
+            auto const w = buf_[i].load(
+                std::memory_order_relaxed);
+            std::memcpy(buf + i * 8, &w, 8);
+        }
+        std::atomic_thread_fence(
+            std::memory_order_acquire);
+        if(seq_.load(std::memory_order_relaxed) == s0)
+            break;
+    }
+    std::memcpy(dest, buf, size);
+}
+
+// Only one caller formats the new date,
+// the others keep reading the old one
+void
+date_service::
+update(std::time_t now) noexcept
+{
+    auto s = seq_.load(std::memory_order_relaxed);
+    if( (s & 1) ||
+        ! seq_.compare_exchange_strong(
+            s, s + 1,
+            std::memory_order_relaxed))
+        return;
+    std::atomic_thread_fence(
+        std::memory_order_release);
+
+    // another caller published a later time
+    // between the check and the exchange
+    if(time_.load(std::memory_order_relaxed) >=
+        static_cast<std::int64_t>(now))
+    {
+        seq_.store(s + 2, std::memory_order_release);
+        return;
+    }
+
+    char buf[words * 8] = {};
+    format(now, buf);
+    for(std::size_t i = 0; i < words; ++i)
+    {
+        std::uint64_t w;
+        std::memcpy(&w, buf + i * 8, 8);
+        buf_[i].store(w, std::memory_order_relaxed);
+    }
+    time_.store(
+        static_cast<std::int64_t>(now),
+        std::memory_order_relaxed);
+    seq_.store(s + 2, std::memory_order_release);
+}
+
+void
+date_service::
+format(
+    std::time_t t,
+    char* dest) noexcept
+{
+    static constexpr char const* wkday[] = {
+        "Sun", "Mon", "Tue", "Wed",
+        "Thu", "Fri", "Sat" };
+    static constexpr char const* month[] = {
+        "Jan", "Feb", "Mar", "Apr", "May", "Jun",
+        "Jul", "Aug", "Sep", "Oct", "Nov", "Dec" };
+
+    auto const v = static_cast<std::int64_t>(t);
+    auto z = v / 86400;
+    auto sec = v % 86400;
+    if(sec < 0)
+    {
+        sec += 86400;
+        --z;
+    }
+    // 1970-01-01 was a Thursday
+    auto wd = (z + 4) % 7;
+    if(wd < 0)
+        wd += 7;
+
+    // days to civil date, proleptic Gregorian
+    z += 719468;
+    auto const era =
+        (z >= 0 ? z : z - 146096) / 146097;
+    auto const doe = z - era * 146097;
+    auto const yoe = (doe - doe / 1460 +
+        doe / 36524 - doe / 146096) / 365;
+    auto const doy = doe -
+        (365 * yoe + yoe / 4 - yoe / 100);
+    auto const mp = (5 * doy + 2) / 153;
+    auto const d = doy - (153 * mp + 2) / 5 + 1;
+    auto const m = mp < 10 ? mp + 3 : mp - 9;
+    auto y = yoe + era * 400 + (m <= 2);
+    y %= 10000;
+    if(y < 0)
+        y += 10000;
+
+    // Sun, 06 Nov 1994 08:49:37 GMT
+    std::memcpy(dest, wkday[wd], 3);
+    dest[3] = ',';
+    dest[4] = ' ';
+    put2(dest + 5, static_cast<unsigned>(d));
+    dest[7] = ' ';
+    std::memcpy(dest + 8, month[m - 1], 3);
+    dest[11] = ' ';
+    put2(dest + 12, static_cast<unsigned>(y / 100));
+    put2(dest + 14, static_cast<unsigned>(y % 100));
+    dest[16] = ' ';
+    put2(dest + 17, static_cast<unsigned>(sec / 3600));
+    dest[19] = ':';
+    put2(dest + 20, static_cast<unsigned>(sec / 60 % 60));
+    dest[22] = ':';
+    put2(dest + 23, static_cast<unsigned>(sec % 60));
+    std::memcpy(dest + 25, " GMT", 4);
+}
+
+//------------------------------------------------
+
+date_service&
+install_date_service(
+    context& ctx)
+{
+    return ctx.make_service<
+        date_service>();
+}
+
+} // http_proto
+} // boost
@@ -0,0 +1,350 @@
+//
+// Copyright (c) 2026 agent (agent@local)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/cppalliance/http_proto
+//
+
+#include <boost/http_proto/service/uring_service.hpp>
+
+#if BOOST_HTTP_PROTO_USE_IO_URING
+
+#include <boost/http_proto/detail/except.hpp>
+#include <boost/system/error_code.hpp>
+#include <cstring>
+#include <errno.h>
+#include <linux/io_uring.h>
+#include <sys/eventfd.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+namespace boost {
+namespace http_proto {
+
+namespace {
+
+// The ring is used through the raw system
+// calls, so that liburing is not required.
+class ring
+    : public uring_service
+{
+    int fd_ = -1;
+    int efd_ = -1;
+
+    void* sq_map_ = nullptr;
+    std::size_t sq_map_size_ = 0;
+    void* cq_map_ = nullptr;
+    std::size_t cq_map_size_ = 0;
+    io_uring_sqe* sqes_ = nullptr;
+    std::size_t sqes_size_ = 0;
+
+    unsigned* sq_tail_;
+    unsigned sq_mask_;
+    unsigned* sq_array_;
+    unsigned* cq_head_;
+    unsigned* cq_tail_;
+    unsigned cq_mask_;
+    io_uring_cqe* cqes_;
+
+    std::size_t inflight_ = 0;
+
+public:
+    ring(
+        context&,
+        unsigned entries)
+    {
+        try
+        {
+            setup(entries);
+        }
+        catch(...)
+        {
+            destroy();
+            throw;
+        }
+    }
+
+    ~ring()
+    {
+        // the kernel may still refer to the
+        // buffers of operations in flight
+        while(inflight_ > 0)
+        {
+            if( enter(fd_, 0, 1,
+                    IORING_ENTER_GETEVENTS) < 0 &&
+                errno != EINTR)
+                break;
+            reap(false);
+        }
+        destroy();
+    }
+
+    void
+    read(
+        int fd,
+        void* data,
+        std::size_t size,
+        std::uint64_t offset,
+        operation& op) override
+    {
+        submit(IORING_OP_READ,
+            fd, data, size, offset, op);
+    }
+
+    void
+    write(
+        int fd,
+        void const* data,
+        std::size_t size,
+        std::uint64_t offset,
+        operation& op) override
+    {
+        submit(IORING_OP_WRITE,
+            fd, const_cast<void*>(data),
+            size, offset, op);
+    }
+
+    std::size_t
+    poll() override
+    {
+        clear_event();
+        return reap();
+    }
+
+    std::size_t
+    run_one() override
+    {
+        clear_event();
+        auto n = reap();
+        while(n == 0 && inflight_ > 0)
+        {
+            if( enter(fd_, 0, 1,
+                    IORING_ENTER_GETEVENTS) < 0 &&
+                errno != EINTR)
+                throw_errno(errno);
+            n = reap();
+        }
+        return n;
+    }
+
+    int
+    native_handle() const noexcept override
+    {
+        return efd_;
+    }
+
+private:
+    static
+    int
+    enter(
+        int fd,
+        unsigned to_submit,
+        unsigned min_complete,
+        unsigned flags) noexcept
+    {
+        return static_cast<int>(::syscall(
+            __NR_io_uring_enter, fd, to_submit,
+            min_complete, flags, nullptr, 0));
+    }
+
+    static
+    void
+    throw_errno(int ev)
+    {
+        detail::throw_system_error(
+            system::error_code(ev,
+                system::system_category()));
+    }
+
+    static
+    void*
+    map(int fd, std::size_t n, off_t off)
+    {
+        void* p = ::mmap(nullptr, n,
+            PROT_READ | PROT_WRITE,
+            MAP_SHARED | MAP_POPULATE,
+            fd, off);
+        if(p == MAP_FAILED)
+            throw_errno(errno);
+        return p;
+    }
+
+    void
+    setup(unsigned entries)
+    {
+        io_uring_params p;
+        std::memset(&p, 0, sizeof(p));
+        fd_ = static_cast<int>(::syscall(
+            __NR_io_uring_setup, entries, &p));
+        if(fd_ < 0)
+            throw_errno(errno);
+
+        sq_map_size_ = p.sq_off.array +
+            p.sq_entries * sizeof(unsigned);
+        cq_map_size_ = p.cq_off.cqes +
+            p.cq_entries * sizeof(io_uring_cqe);
+        if(p.features & IORING_FEAT_SINGLE_MMAP)
+        {
+            if(cq_map_size_ > sq_map_size_)
+                sq_map_size_ = cq_map_size_;
+        }
+        sq_map_ = map(fd_,
+            sq_map_size_, IORING_OFF_SQ_RING);
+        if(p.features & IORING_FEAT_SINGLE_MMAP)
+        {
+            cq_map_ = sq_map_;
+        }
+        else
+        {
+            cq_map_ = map(fd_,
+                cq_map_size_, IORING_OFF_CQ_RING);
+        }
+        sqes_size_ =
+            p.sq_entries * sizeof(io_uring_sqe);
+        sqes_ = static_cast<io_uring_sqe*>(
+            map(fd_, sqes_size_, IORING_OFF_SQES));
+
+        auto sq = static_cast<char*>(sq_map_);
+        sq_tail_ = reinterpret_cast<
+            unsigned*>(sq + p.sq_off.tail);
+        sq_mask_ = *reinterpret_cast<
+            unsigned*>(sq + p.sq_off.ring_mask);
+        sq_array_ = reinterpret_cast<
+            unsigned*>(sq + p.sq_off.array);
+
+        auto cq = static_cast<char*>(cq_map_);
+        cq_head_ = reinterpret_cast<
+            unsigned*>(cq + p.cq_off.head);
+        cq_tail_ = reinterpret_cast<
+            unsigned*>(cq + p.cq_off.tail);
+        cq_mask_ = *reinterpret_cast<
+            unsigned*>(cq + p.cq_off.ring_mask);
+        cqes_ = reinterpret_cast<
+            io_uring_cqe*>(cq + p.cq_off.cqes);
+
+        efd_ = ::eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+        if(efd_ < 0)
+            throw_errno(errno);
+        if(::syscall(__NR_io_uring_register, fd_,
+            IORING_REGISTER_EVENTFD, &efd_, 1) != 0)
+            throw_errno(errno);
+    }
+
+    void
+    destroy() noexcept
+    {
+        if(sqes_)
+            ::munmap(sqes_, sqes_size_);
+        if(cq_map_ && cq_map_ != sq_map_)
+            ::munmap(cq_map_, cq_map_size_);
+        if(sq_map_)
+            ::munmap(sq_map_, sq_map_size_);
+        if(efd_ != -1)
+            ::close(efd_);
+        if(fd_ != -1)
+            ::close(fd_);
+    }
+
+    void
+    submit(
+        unsigned char opcode,
+        int fd,
+        void* data,
+        std::size_t size,
+        std::uint64_t offset,
+        operation& op)
+    {
+        // each operation is submitted at once,
+        // so the submission queue is never full
+        unsigned const tail = *sq_tail_;
+        unsigned const i = tail & sq_mask_;
+        io_uring_sqe& sqe = sqes_[i];
+        std::memset(&sqe, 0, sizeof(sqe));
+        sqe.opcode = opcode;
+        sqe.fd = fd;
+        sqe.addr = reinterpret_cast<
+            std::uintptr_t>(data);
+        sqe.len = static_cast<unsigned>(
+            size > 0x7ffff000 ? 0x7ffff000 : size);
+        sqe.off = offset;
+        sqe.user_data = reinterpret_cast<
+            std::uintptr_t>(&op);
+        sq_array_[i] = i;
+        __atomic_store_n(sq_tail_, tail + 1,
+            __ATOMIC_RELEASE);
+
+        for(;;)
+        {
+            int rv = enter(fd_, 1, 0, 0);
+            if(rv >= 0)
+                break;
+            if(errno == EINTR)
+                continue;
+            // take back the entry
+            __atomic_store_n(sq_tail_, tail,
+                __ATOMIC_RELEASE);
+            throw_errno(errno);
+        }
+        ++inflight_;
+    }
+
+    // deliver completions, or
+    // discard them on shutdown
+    std::size_t
+    reap(bool deliver = true) noexcept
+    {
+        std::size_t n = 0;
+        unsigned head = *cq_head_;
+        for(;;)
+        {
+            unsigned const tail = __atomic_load_n(
+                cq_tail_, __ATOMIC_ACQUIRE);
+            if(head == tail)
+                break;
+            io_uring_cqe const cqe =
+                cqes_[head & cq_mask_];
+            ++head;
+            // release the entry before the
+            // handler can submit more work
+            __atomic_store_n(cq_head_, head,
+                __ATOMIC_RELEASE);
+            --inflight_;
+            ++n;
+            if(deliver)
+            {
+                auto op = reinterpret_cast<
+                    operation*>(cqe.user_data);
+                op->on_complete(cqe.res);
+            }
+        }
+        return n;
+    }
+
+    void
+    clear_event() noexcept
+    {
+        std::uint64_t v;
+        while(::read(efd_, &v, sizeof(v)) > 0)
+        {
+        }
+    }
+};
+
+} // (anon)
+
+uring_service&
+install_uring_service(
+    context& ctx,
+    unsigned entries)
+{
+    return ctx.make_service<
+        ring>(entries);
+}
+
+} // http_proto
+} // boost
+
+#endif
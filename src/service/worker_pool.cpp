@@ -0,0 +1,134 @@
+//
+// Copyright (c) 2026 agent (agent@local)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/cppalliance/http_proto
+//
+
+#include <boost/http_proto/service/worker_pool.hpp>
+
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace boost {
+namespace http_proto {
+
+namespace {
+
+class thread_pool
+    : public worker_pool
+{
+    std::mutex m_;
+    std::condition_variable cv_;
+    work* head_ = nullptr;
+    work* tail_ = nullptr;
+    bool stop_ = false;
+    std::vector<std::thread> threads_;
+
+public:
+    thread_pool(
+        context&,
+        std::size_t n)
+    {
+        if(n == 0)
+            n = std::thread::hardware_concurrency();
+        if(n == 0)
+            n = 1;
+        threads_.reserve(n);
+        try
+        {
+            while(n--)
+                threads_.emplace_back(
+                    [this]{ loop(); });
+        }
+        catch(...)
+        {
+            shutdown();
+            throw;
+        }
+    }
+
+    ~thread_pool()
+    {
+        shutdown();
+    }
+
+    std::size_t
+    concurrency() const noexcept override
+    {
+        return threads_.size();
+    }
+
+    void
+    post(work& w) override
+    {
+        {
+            std::lock_guard<
+                std::mutex> lock(m_);
+            w.next = nullptr;
+            if(tail_)
+                tail_->next = &w;
+            else
+                head_ = &w;
+            tail_ = &w;
+        }
+        cv_.notify_one();
+    }
+
+private:
+    void
+    shutdown() noexcept
+    {
+        {
+            std::lock_guard<
+                std::mutex> lock(m_);
+            stop_ = true;
+        }
+        cv_.notify_all();
+        for(auto& t : threads_)
+            t.join();
+        threads_.clear();
+    }
+
+    void
+    loop() noexcept
+    {
+        std::unique_lock<
+            std::mutex> lock(m_);
+        for(;;)
+        {
+            // pending work runs before stopping
+            cv_.wait(lock, [this]
+                {
+                    return head_ || stop_;
+                });
+            if(! head_)
+                return;
+            work* w = head_;
+            head_ = w->next;
+            if(! head_)
+                tail_ = nullptr;
+            lock.unlock();
+            w->run();
+            lock.lock();
+        }
+    }
+};
+
+} // (anon)
+
+worker_pool&
+install_worker_pool(
+    context& ctx,
+    std::size_t threads)
+{
+    return ctx.make_service<
+        thread_pool>(threads);
+}
+
+} // http_proto
+} // boost
@@ -37,5 +37,11 @@ on_write(
     return rv;
 }
 
+void
+sink::
+on_size_hint(std::uint64_t) noexcept
+{
+}
+
 } // http_proto
 } // boost
@@ -0,0 +1,204 @@
+//
+// Copyright (c) 2026 agent (agent@local)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/cppalliance/http_proto
+//
+
+#include <boost/http_proto/uring_body.hpp>
+
+#if BOOST_HTTP_PROTO_USE_IO_URING
+
+#include <boost/system/system_error.hpp>
+#include <cstring>
+
+namespace boost {
+namespace http_proto {
+
+void
+uring_body::
+op_type::
+on_complete(int res) noexcept
+{
+    auto& b = *self;
+    b.pending_ = false;
+    if(res < 0)
+    {
+        b.ec_.assign(-res,
+            system::system_category());
+        return;
+    }
+    auto const n =
+        static_cast<std::size_t>(res);
+    if(! b.writing_)
+    {
+        // end of file
+        if(n == 0)
+            b.n_ = 0;
+        b.n_ -= n;
+        b.end_ = n;
+        return;
+    }
+    b.begin_ += n;
+    if(b.begin_ < b.end_)
+    {
+        // short write
+        b.start(true);
+    }
+}
+
+uring_body::
+~uring_body()
+{
+    try
+    {
+        while(pending_)
+            f_.service().run_one();
+    }
+    catch(system::system_error const&)
+    {
+    }
+}
+
+uring_body::
+uring_body(
+    file_uring&& f,
+    std::uint64_t size,
+    std::size_t buffer_size)
+    : f_(std::move(f))
+    , n_(size)
+    , buf_(new unsigned char[
+        buffer_size > 0 ? buffer_size : 1])
+    , cap_(buffer_size > 0 ? buffer_size : 1)
+    , op_(this)
+{
+}
+
+void
+uring_body::
+start(bool write) noexcept
+{
+    writing_ = write;
+    pending_ = true;
+    try
+    {
+        if(write)
+        {
+            f_.async_write(
+                buf_.get() + begin_,
+                end_ - begin_, op_);
+        }
+        else
+        {
+            begin_ = 0;
+            end_ = 0;
+            std::size_t n = cap_;
+            if( n > n_)
+                n = static_cast<std::size_t>(n_);
+            f_.async_read(
+                buf_.get(), n, op_);
+        }
+    }
+    catch(system::system_error const& e)
+    {
+        pending_ = false;
+        ec_ = e.code();
+    }
+}
+
+auto
+uring_body::
+on_read(
+    buffers::mutable_buffer b) ->
+        source::results
+{
+    source::results rv;
+    if(pending_)
+    {
+        rv.ec = error::would_block;
+        return rv;
+    }
+    if(ec_.failed())
+    {
+        rv.ec = ec_;
+        return rv;
+    }
+
+    std::size_t n = end_ - begin_;
+    if( n > b.size())
+        n = b.size();
+    if(n > 0)
+    {
+        std::memcpy(b.data(),
+            buf_.get() + begin_, n);
+        begin_ += n;
+        rv.bytes = n;
+    }
+
+    // read ahead while the
+    // caller sends this data
+    if( begin_ == end_ && n_ > 0)
+        start(false);
+
+    rv.finished =
+        n_ == 0 && begin_ == end_;
+    if( ec_.failed())
+        rv.ec = ec_;
+    else if(n == 0 && ! rv.finished)
+        rv.ec = error::would_block;
+    return rv;
+}
+
+auto
+uring_body::
+on_write(
+    buffers::const_buffer b, bool more) ->
+        sink::results
+{
+    sink::results rv;
+    if(pending_)
+    {
+        rv.ec = error::would_block;
+        return rv;
+    }
+    if(ec_.failed())
+    {
+        rv.ec = ec_;
+        return rv;
+    }
+
+    std::size_t n = b.size();
+    if( n > cap_)
+        n = cap_;
+    if( n > n_)
+        n = static_cast<std::size_t>(n_);
+    if(n > 0)
+    {
+        std::memcpy(
+            buf_.get(), b.data(), n);
+        begin_ = 0;
+        end_ = n;
+        n_ -= n;
+        rv.bytes = n;
+        start(true);
+    }
+
+    if( ec_.failed())
+        rv.ec = ec_;
+    else if(pending_ && (
+        rv.bytes < b.size() || ! more))
+    {
+        // the rest of the data, or the
+        // end of the body, waits for the
+        // write to complete
+        rv.ec = error::would_block;
+    }
+    return rv;
+}
+
+} // http_proto
+} // boost
+
+#endif
@@ -0,0 +1,115 @@
+//
+// Copyright (c) 2026 agent (agent@local)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/cppalliance/http_proto
+//
+
+// Test that header file is self-contained.
+#include <boost/http_proto/accept_encoding.hpp>
+
+#include <boost/http_proto/request.hpp>
+
+#include "test_suite.hpp"
+
+namespace boost {
+namespace http_proto {
+
+struct accept_encoding_test
+{
+    void
+    testValue()
+    {
+        auto const check = [](
+            core::string_view s,
+            encoding e)
+        {
+            BOOST_TEST(negotiate_encoding(s) == e);
+        };
+
+        // common values
+        check("gzip, deflate, br, zstd", encoding::gzip);
+        check("gzip, deflate, br", encoding::gzip);
+        check("gzip, deflate", encoding::gzip);
+        check("deflate, gzip", encoding::gzip);
+        check("gzip", encoding::gzip);
+        check("identity", encoding::identity);
+        check("*", encoding::gzip);
+
+        // parsed values
+        check("", encoding::identity);
+        check("deflate", encoding::deflate);
+        check("DEFLATE", encoding::deflate);
+        check("x-gzip", encoding::gzip);
+        check("br, zstd", encoding::identity);
+        check("gzip;q=0.5, deflate", encoding::deflate);
+        check("gzip;q=0.5, deflate;q=0.5", encoding::gzip);
+        check("gzip;q=0", encoding::identity);
+        check("gzip;q=0.5", encoding::gzip);
+        check("gzip;q=0.5, identity", encoding::identity);
+        check("gzip, identity;q=0.5", encoding::gzip);
+        check("*;q=0.2, gzip;q=0.1", encoding::deflate);
+        check("identity;q=0", encoding::unsupported);
+        check("*;q=0", encoding::unsupported);
+        check("*;q=0, identity", encoding::identity);
+        check("*;q=0, deflate", encoding::deflate);
+
+        // malformed values accept only identity
+        check("gzip;q=2", encoding::identity);
+        check("gzip deflate", encoding::identity);
+
+        // order of preference
+        BOOST_TEST(negotiate_encoding(
+            "gzip, deflate, br, zstd",
+            { encoding::br, encoding::gzip }) == encoding::br);
+        BOOST_TEST(negotiate_encoding(
+            "gzip, deflate, br, zstd",
+            { encoding::zstd, encoding::br }) == encoding::zstd);
+        BOOST_TEST(negotiate_encoding(
+            "gzip, deflate",
+            { encoding::deflate, encoding::gzip }) == encoding::deflate);
+        BOOST_TEST(negotiate_encoding(
+            "gzip, deflate", {}) == encoding::identity);
+    }
+
+    void
+    testFields()
+    {
+        {
+            request req;
+            BOOST_TEST(negotiate_encoding(req) ==
+                encoding::identity);
+        }
+        {
+            request req;
+            req.append(field::accept_encoding, "br");
+            req.append(field::accept_encoding, "deflate");
+            BOOST_TEST(negotiate_encoding(req) ==
+                encoding::deflate);
+        }
+        {
+            request req;
+            req.append(field::accept_encoding, "gzip;q=0.1");
+            req.append(field::accept_encoding, "gzip");
+            req.append(field::accept_encoding, "deflate;q=0.5");
+            BOOST_TEST(negotiate_encoding(req) ==
+                encoding::gzip);
+        }
+    }
+
+    void
+    run()
+    {
+        testValue();
+        testFields();
+    }
+};
+
+TEST_SUITE(
+    accept_encoding_test,
+    "boost.http_proto.accept_encoding");
+
+} // http_proto
+} // boost
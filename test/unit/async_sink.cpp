@@ -0,0 +1,193 @@
+//
+// Copyright (c) 2026 agent (agent@local)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/cppalliance/http_proto
+//
+
+// Test that header file is self-contained.
+#include <boost/http_proto/async_sink.hpp>
+
+#include <boost/http_proto/request_parser.hpp>
+#include <boost/buffers/buffer_copy.hpp>
+#include <boost/buffers/make_buffer.hpp>
+
+#include "test_helpers.hpp"
+
+#include <algorithm>
+#include <cstdio>
+#include <string>
+
+namespace boost {
+namespace http_proto {
+
+struct async_sink_test
+{
+    // completes each operation when
+    // the test calls run_one
+    struct deferred_sink : async_sink
+    {
+        std::string& s_;
+        buffers::const_buffer b_;
+        bool started_ = false;
+        bool sync_ = false;
+
+        deferred_sink(
+            std::string& s,
+            bool sync) noexcept
+            : s_(s)
+            , sync_(sync)
+        {
+        }
+
+        void
+        on_start(
+            buffers::const_buffer b,
+            bool) override
+        {
+            BOOST_TEST(! started_);
+            b_ = b;
+            started_ = true;
+            if(sync_)
+                run_one();
+        }
+
+        // at most 1000 bytes
+        // in each operation
+        void
+        run_one()
+        {
+            BOOST_TEST(started_);
+            started_ = false;
+            auto const n = (std::min)(
+                b_.size(), std::size_t(1000));
+            s_.append(static_cast<
+                char const*>(b_.data()), n);
+            complete(n);
+        }
+    };
+
+    struct counter
+        : async_sink::handler
+    {
+        std::size_t n = 0;
+
+        void
+        on_resume() noexcept override
+        {
+            ++n;
+        }
+    };
+
+    void
+    testSink()
+    {
+        auto const contents =
+            test_contents(10000);
+
+        context ctx;
+        request_parser::config cfg;
+        cfg.body_limit = 1024 * 1024;
+        install_parser_service(ctx, cfg);
+
+        for(bool chunked : { false, true })
+        for(bool sync : { false, true })
+        {
+            std::string msg = "POST / HTTP/1.1\r\n";
+            if(chunked)
+            {
+                char hex[16];
+                std::snprintf(hex, sizeof(hex),
+                    "%zx", contents.size());
+                msg += "Transfer-Encoding: chunked\r\n\r\n";
+                msg += hex;
+                msg += "\r\n" + contents + "\r\n0\r\n\r\n";
+            }
+            else
+            {
+                msg += "Content-Length: " +
+                    std::to_string(contents.size()) +
+                    "\r\n\r\n" + contents;
+            }
+
+            request_parser pr(ctx);
+            pr.reset();
+            pr.start();
+            core::string_view in = msg;
+            std::string out;
+            counter c;
+            deferred_sink* body = nullptr;
+            std::size_t blocked = 0;
+            for(;;)
+            {
+                system::error_code ec;
+                pr.parse(ec);
+                if(ec == error::would_block)
+                {
+                    // an operation is always in flight,
+                    // even after a short write
+                    ++blocked;
+                    if(! BOOST_TEST(body->is_pending()))
+                        break;
+                    body->run_one();
+                    continue;
+                }
+                if(! body && pr.got_header())
+                {
+                    body = &pr.set_body<deferred_sink>(
+                        out, sync);
+                    body->set_handler(&c);
+                    continue;
+                }
+                if(ec == condition::need_more_input)
+                {
+                    if(! BOOST_TEST(! in.empty()))
+                        break;
+                    auto const n =
+                        buffers::buffer_copy(
+                            pr.prepare(),
+                            buffers::make_buffer(
+                                in.data(),
+                                (std::min)(
+                                    in.size(),
+                                    std::size_t(3000))));
+                    pr.commit(n);
+                    in.remove_prefix(n);
+                    continue;
+                }
+                if(! BOOST_TEST(! ec.failed()))
+                    break;
+                if(pr.is_complete())
+                    break;
+            }
+            BOOST_TEST(pr.is_complete());
+            BOOST_TEST(! body->is_pending());
+            if(sync)
+            {
+                BOOST_TEST_EQ(blocked, 0u);
+                BOOST_TEST_EQ(c.n, 0u);
+            }
+            else
+            {
+                BOOST_TEST_GT(c.n, 0u);
+                BOOST_TEST_EQ(c.n, blocked);
+            }
+            BOOST_TEST(out == contents);
+        }
+    }
+
+    void
+    run()
+    {
+        testSink();
+    }
+};
+
+TEST_SUITE(
+    async_sink_test,
+    "boost.http_proto.async_sink");
+
+} // http_proto
+} // boost
@@ -0,0 +1,156 @@
+//
+// Copyright (c) 2026 agent (agent@local)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/cppalliance/http_proto
+//
+
+// Test that header file is self-contained.
+#include <boost/http_proto/async_source.hpp>
+
+#include <boost/http_proto/response.hpp>
+#include <boost/http_proto/serializer.hpp>
+#include <boost/buffers/buffer_copy.hpp>
+#include <boost/buffers/buffer_size.hpp>
+#include <boost/buffers/make_buffer.hpp>
+
+#include "test_helpers.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <string>
+
+namespace boost {
+namespace http_proto {
+
+struct async_source_test
+{
+    // completes each operation when
+    // the test calls run_one
+    struct deferred_source : async_source
+    {
+        core::string_view s_;
+        buffers::mutable_buffer b_;
+        bool started_ = false;
+        bool sync_ = false;
+
+        explicit
+        deferred_source(
+            core::string_view s) noexcept
+            : s_(s)
+        {
+        }
+
+        void
+        on_start(
+            buffers::mutable_buffer b) override
+        {
+            BOOST_TEST(! started_);
+            b_ = b;
+            started_ = true;
+            if(sync_)
+                run_one();
+        }
+
+        // at most 1000 bytes
+        // in each operation
+        void
+        run_one()
+        {
+            BOOST_TEST(started_);
+            started_ = false;
+            auto const n = (std::min)({
+                s_.size(), b_.size(),
+                std::size_t(1000) });
+            std::memcpy(b_.data(), s_.data(), n);
+            s_.remove_prefix(n);
+            complete(n, s_.empty());
+        }
+    };
+
+    struct counter
+        : async_source::handler
+    {
+        std::size_t n = 0;
+
+        void
+        on_resume() noexcept override
+        {
+            ++n;
+        }
+    };
+
+    void
+    testSource()
+    {
+        auto const contents =
+            test_contents(10000);
+
+        context ctx;
+        serializer sr(ctx);
+        for(bool sync : { false, true })
+        {
+            response res;
+            res.set_content_length(contents.size());
+            sr.reset();
+            auto& body = sr.start<deferred_source>(
+                res, contents);
+            body.sync_ = sync;
+            counter c;
+            body.set_handler(&c);
+
+            std::string out;
+            std::size_t blocked = 0;
+            while(! sr.is_done())
+            {
+                auto rv = sr.prepare();
+                if( rv.has_error() &&
+                    rv.error() == error::would_block)
+                {
+                    // an operation is always in flight
+                    ++blocked;
+                    if(! BOOST_TEST(body.is_pending()))
+                        break;
+                    body.run_one();
+                    continue;
+                }
+                auto cbs = rv.value();
+                auto const n =
+                    buffers::buffer_size(cbs);
+                std::string s(n, 0);
+                buffers::buffer_copy(
+                    buffers::make_buffer(&s[0], n), cbs);
+                out += s;
+                sr.consume(n);
+            }
+            BOOST_TEST(! body.is_pending());
+            if(sync)
+            {
+                BOOST_TEST_EQ(blocked, 0u);
+                BOOST_TEST_EQ(c.n, 0u);
+            }
+            else
+            {
+                BOOST_TEST_GT(blocked, 0u);
+                BOOST_TEST_EQ(c.n, blocked);
+            }
+            BOOST_TEST_EQ(out,
+                std::string(res.buffer()) + contents);
+        }
+    }
+
+    void
+    run()
+    {
+        testSource();
+    }
+};
+
+TEST_SUITE(
+    async_source_test,
+    "boost.http_proto.async_source");
+
+} // http_proto
+} // boost
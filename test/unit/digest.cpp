@@ -0,0 +1,331 @@
+//
+// Copyright (c) 2026 agent (agent@local)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/cppalliance/http_proto
+//
+
+// Test that header file is self-contained.
+#include <boost/http_proto/digest.hpp>
+
+#include <boost/http_proto/context.hpp>
+#include <boost/http_proto/error.hpp>
+#include <boost/http_proto/file_region.hpp>
+#include <boost/http_proto/response.hpp>
+#include <boost/http_proto/response_parser.hpp>
+#include <boost/http_proto/serializer.hpp>
+#include <boost/http_proto/source.hpp>
+#include <boost/buffers/buffer_copy.hpp>
+#include <boost/buffers/buffer_size.hpp>
+#include <boost/buffers/string_buffer.hpp>
+
+#include "test_helpers.hpp"
+
+#include <functional>
+#include <string>
+
+namespace boost {
+namespace http_proto {
+
+// test vectors
+static char const* const crc_input = "123456789";
+static char const* const crc_hex = "e3069283";
+static char const* const sha_input =
+    "abcdbcdecdefdefgefghfghighijhijkijkljklmklmnlmnomnopnopq";
+static char const* const sha_hex =
+    "248d6a61d20638b8e5c026930c3e6039"
+    "a33ce45964ff2167f6ecedd419db06c1";
+
+struct digest_test
+{
+    // a source which returns one byte per read
+    struct byte_source : source
+    {
+        std::string s;
+
+        explicit
+        byte_source(std::string s_)
+            : s(std::move(s_))
+        {
+        }
+
+        results
+        on_read(buffers::mutable_buffer b) override
+        {
+            results rv;
+            if(! s.empty())
+            {
+                *static_cast<char*>(b.data()) = s[0];
+                s.erase(0, 1);
+                rv.bytes = 1;
+            }
+            rv.finished = s.empty();
+            return rv;
+        }
+    };
+
+    static
+    void
+    parse(
+        response_parser& pr,
+        core::string_view s)
+    {
+        auto const n = buffers::buffer_copy(
+            pr.prepare(),
+            buffers::const_buffer(s.data(), s.size()));
+        BOOST_TEST_EQ(n, s.size());
+        pr.commit(n);
+        system::error_code ec;
+        do
+        {
+            pr.parse(ec);
+        }
+        while(! ec && ! pr.is_complete());
+        BOOST_TEST(! ec.failed());
+        BOOST_TEST(pr.is_complete());
+    }
+
+    void
+    testDigest()
+    {
+        digest d;
+        BOOST_TEST(d.empty());
+        BOOST_TEST_EQ(d.size(), 0u);
+        BOOST_TEST(d.algorithm() == digest_algorithm::none);
+        BOOST_TEST(d.to_hex().empty());
+        BOOST_TEST(d.to_field_value().empty());
+
+        BOOST_TEST_EQ(
+            to_string(digest_algorithm::none), "");
+        BOOST_TEST_EQ(
+            to_string(digest_algorithm::crc32c), "crc32c");
+        BOOST_TEST_EQ(
+            to_string(digest_algorithm::sha256), "sha-256");
+
+        unsigned char const v[] = { 0xe3, 0x06, 0x92, 0x83 };
+        digest c(digest_algorithm::crc32c, v);
+        BOOST_TEST_EQ(c.size(), 4u);
+        BOOST_TEST_EQ(c.to_hex(), crc_hex);
+        BOOST_TEST_EQ(c.to_field_value(), "crc32c=:4waSgw==:");
+        BOOST_TEST(c == digest(digest_algorithm::crc32c, v));
+        BOOST_TEST(c != d);
+    }
+
+    void
+    testSerializer()
+    {
+        context ctx;
+        serializer sr(ctx);
+
+        // buffers
+        {
+            response res;
+            res.set_content_length(3);
+            sr.reset();
+            sr.compute_digest(digest_algorithm::sha256);
+            sr.start(res, buffers::const_buffer("abc", 3));
+            test_serialize(sr);
+            BOOST_TEST_EQ(
+                sr.body_digest().to_field_value(),
+                "sha-256=:ungWv48Bz+pBQUDeXa4iI7ADYaOWF3qctBD/YfIAFa0=:");
+        }
+
+        // empty body
+        {
+            response res;
+            res.set_content_length(0);
+            sr.reset();
+            sr.compute_digest(digest_algorithm::sha256);
+            sr.start(res);
+            test_serialize(sr);
+            BOOST_TEST_EQ(
+                sr.body_digest().to_field_value(),
+                "sha-256=:47DEQpj8HBSa+/TImW+5JCeuQeRkm5NMpJWZG3hSuFU=:");
+        }
+
+        // source, chunked
+        {
+            response res;
+            res.set_chunked(true);
+            sr.reset();
+            sr.compute_digest(digest_algorithm::crc32c);
+            sr.start<byte_source>(res, crc_input);
+            test_serialize(sr);
+            BOOST_TEST_EQ(
+                sr.body_digest().to_hex(), crc_hex);
+        }
+
+        // stream
+        {
+            response res;
+            res.set_chunked(true);
+            sr.reset();
+            sr.compute_digest(digest_algorithm::sha256);
+            auto stream = sr.start_stream(res);
+            core::string_view s = sha_input;
+            while(! s.empty())
+            {
+                auto const n = buffers::buffer_copy(
+                    stream.prepare(),
+                    buffers::const_buffer(s.data(),
+                        s.size() < 10 ? s.size() : 10));
+                stream.commit(n);
+                s.remove_prefix(n);
+                auto cbs = sr.prepare().value();
+                sr.consume(buffers::buffer_size(cbs));
+            }
+            stream.close();
+            test_serialize(sr);
+            BOOST_TEST_EQ(
+                sr.body_digest().to_hex(), sha_hex);
+        }
+
+        // the result is available as the body is sent
+        {
+            response res;
+            res.set_content_length(9);
+            sr.reset();
+            sr.compute_digest(digest_algorithm::crc32c);
+            sr.start<byte_source>(res, crc_input);
+            while(! sr.is_message_end())
+            {
+                auto cbs = sr.prepare().value();
+                if(! sr.is_message_end())
+                    sr.consume(buffers::buffer_size(cbs));
+            }
+            BOOST_TEST_EQ(
+                sr.body_digest().to_hex(), crc_hex);
+        }
+
+        // cleared by reset
+        sr.reset();
+        BOOST_TEST(sr.body_digest().empty());
+
+        // only one digest
+        sr.compute_digest(digest_algorithm::sha256);
+        BOOST_TEST_THROWS(
+            sr.compute_digest(digest_algorithm::crc32c),
+            std::logic_error);
+
+        // a region is never read
+        {
+            response res;
+            res.set_content_length(0);
+            BOOST_TEST_THROWS(
+                sr.start(res, file_region{ {}, 0, 0 }),
+                std::logic_error);
+        }
+    }
+
+    void
+    testParser()
+    {
+        context ctx;
+        response_parser::config cfg;
+        install_parser_service(ctx, cfg);
+        response_parser pr(ctx);
+
+        // before start
+        pr.reset();
+        BOOST_TEST_THROWS(
+            pr.compute_digest(digest_algorithm::sha256),
+            std::logic_error);
+
+        // in place
+        pr.start();
+        pr.compute_digest(digest_algorithm::crc32c);
+        parse(pr,
+            "HTTP/1.1 200 OK\r\n"
+            "Content-Length: 9\r\n"
+            "\r\n"
+            "123456789");
+        BOOST_TEST_EQ(pr.body(), crc_input);
+        BOOST_TEST_EQ(
+            pr.body_digest().to_hex(), crc_hex);
+
+        // after the body
+        BOOST_TEST_THROWS(
+            pr.compute_digest(digest_algorithm::sha256),
+            std::logic_error);
+
+        // chunked, after the header
+        pr.start();
+        {
+            core::string_view const s =
+                "HTTP/1.1 200 OK\r\n"
+                "Transfer-Encoding: chunked\r\n"
+                "\r\n";
+            auto const n = buffers::buffer_copy(
+                pr.prepare(),
+                buffers::const_buffer(s.data(), s.size()));
+            pr.commit(n);
+            system::error_code ec;
+            pr.parse(ec);
+            BOOST_TEST(pr.got_header());
+            pr.compute_digest(digest_algorithm::sha256);
+            pr.parse(ec);
+            BOOST_TEST_EQ(ec, error::need_data);
+        }
+        parse(pr,
+            "20\r\n"
+            "abcdbcdecdefdefgefghfghighijhijk\r\n"
+            "18\r\n"
+            "ijkljklmklmnlmnomnopnopq\r\n"
+            "0\r\n\r\n");
+        BOOST_TEST_EQ(
+            pr.body_digest().to_hex(), sha_hex);
+
+        // elastic
+        pr.start();
+        {
+            core::string_view const s =
+                "HTTP/1.1 200 OK\r\n"
+                "Content-Length: 56\r\n"
+                "\r\n";
+            auto const n = buffers::buffer_copy(
+                pr.prepare(),
+                buffers::const_buffer(s.data(), s.size()));
+            pr.commit(n);
+            system::error_code ec;
+            pr.parse(ec);
+            BOOST_TEST(pr.got_header());
+        }
+        pr.compute_digest(digest_algorithm::sha256);
+        std::string body;
+        buffers::string_buffer buf(&body);
+        pr.set_body(std::ref(buf));
+        {
+            system::error_code ec;
+            pr.parse(ec);
+            BOOST_TEST_EQ(ec, error::need_data);
+        }
+        parse(pr, sha_input);
+        BOOST_TEST_EQ(body, sha_input);
+        BOOST_TEST_EQ(
+            pr.body_digest().to_hex(), sha_hex);
+
+        // no digest for the next message
+        pr.start();
+        parse(pr,
+            "HTTP/1.1 204 No Content\r\n"
+            "\r\n");
+        BOOST_TEST(pr.body_digest().empty());
+    }
+
+    void
+    run()
+    {
+        testDigest();
+        testSerializer();
+        testParser();
+    }
+};
+
+TEST_SUITE(
+    digest_test,
+    "boost.http_proto.digest");
+
+} // http_proto
+} // boost
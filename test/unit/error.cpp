@@ -75,6 +75,7 @@ public:
         check(n, error::end_of_stream);
         check(n, error::in_place_overflow);
         check(n, error::need_data);
+        check(n, error::would_block);
 
         check(n, error::bad_connection);
         check(n, error::bad_content_length);
@@ -106,6 +107,7 @@ public:
         check(n, error::multiple_content_length);
 
         check(n, error::buffer_overflow);
+        check(n, error::not_acceptable);
 
         //---
 
@@ -10,16 +10,335 @@
 // Test that header file is self-contained.
 #include <boost/http_proto/file_body.hpp>
 
+#include <boost/http_proto/error.hpp>
+#include <boost/http_proto/request_parser.hpp>
+#include <boost/http_proto/response.hpp>
+#include <boost/buffers/buffer_copy.hpp>
+#include <boost/buffers/const_buffer_span.hpp>
+#include <boost/buffers/make_buffer.hpp>
+
 #include "test_suite.hpp"
 
+#include <cstdio>
+#include <memory>
+#include <string>
+
 namespace boost {
 namespace http_proto {
 
 struct file_body_test
 {
+    static
+    void
+    create(
+        std::string const& path,
+        core::string_view contents)
+    {
+        system::error_code ec;
+        file f;
+        f.open(path.c_str(), file_mode::write, ec);
+        BOOST_TEST(! ec.failed());
+        f.write(contents.data(), contents.size(), ec);
+        BOOST_TEST(! ec.failed());
+    }
+
+    static
+    std::string
+    read_all(file_body& body)
+    {
+        std::string s;
+        char buf[64];
+        for(;;)
+        {
+            auto rs = body.read(
+                buffers::make_buffer(buf, sizeof(buf)));
+            BOOST_TEST(! rs.ec.failed());
+            s.append(buf, rs.bytes);
+            if(rs.finished || rs.ec.failed())
+                break;
+        }
+        return s;
+    }
+
+    void
+    testPrecompressed()
+    {
+        std::string const path =
+            "file_body_test_precompressed.txt";
+        create(path, "identity");
+        create(path + ".gz", "gzip");
+        create(path + ".br", "br");
+
+        auto const check = [&](
+            core::string_view accept,
+            core::string_view coding,
+            core::string_view contents)
+        {
+            response res;
+            system::error_code ec;
+            auto body = open_precompressed(
+                path, accept, res, ec);
+            if(! BOOST_TEST(! ec.failed()))
+                return;
+            BOOST_TEST_EQ(
+                res.value_or(field::content_encoding, ""),
+                coding);
+            BOOST_TEST_EQ(
+                res.payload_size(), contents.size());
+            BOOST_TEST_EQ(
+                res.value_or(field::vary, ""),
+                "Accept-Encoding");
+            BOOST_TEST_EQ(read_all(body), contents);
+        };
+
+        check("", "", "identity");
+        check("gzip", "gzip", "gzip");
+        check("x-gzip", "gzip", "gzip");
+        check("gzip, deflate, br", "br", "br");
+        check("gzip, deflate, br, zstd", "br", "br");
+        check("br;q=0.5, gzip", "gzip", "gzip");
+        check("*", "br", "br");
+        check("*, br;q=0", "gzip", "gzip");
+        check("zstd", "", "identity");
+        check("deflate", "", "identity");
+        check("gzip;q=bad", "", "identity");
+
+        // a preferred identity wins
+        check("gzip;q=0.1, identity", "", "identity");
+        check("br;q=0.5, gzip;q=0.1, identity;q=0.5", "br", "br");
+        check("gzip;q=0.1, *;q=0.5", "", "identity");
+        check("gzip;q=0.1", "gzip", "gzip");
+
+        // Vary is not duplicated
+        {
+            response res;
+            res.set(field::vary, "Origin, accept-encoding");
+            system::error_code ec;
+            open_precompressed(path, "gzip", res, ec);
+            BOOST_TEST(! ec.failed());
+            BOOST_TEST_EQ(res.count(field::vary), 1u);
+        }
+
+        // identity clears Content-Encoding
+        {
+            response res;
+            res.set(field::content_encoding, "gzip");
+            system::error_code ec;
+            open_precompressed(path, "", res, ec);
+            BOOST_TEST(! ec.failed());
+            BOOST_TEST(! res.exists(field::content_encoding));
+        }
+
+        // identity is refused
+        {
+            auto const refused = [&](
+                core::string_view accept)
+            {
+                response res;
+                system::error_code ec;
+                open_precompressed(path, accept, res, ec);
+                BOOST_TEST(ec == error::not_acceptable);
+                BOOST_TEST(! res.exists(field::vary));
+            };
+            refused("identity;q=0");
+            refused("*;q=0");
+            refused("zstd, *;q=0");
+            refused("deflate, identity;q=0");
+
+            // a sidecar is still served
+            check("gzip, identity;q=0", "gzip", "gzip");
+        }
+
+        // missing file
+        {
+            response res;
+            system::error_code ec;
+            open_precompressed(
+                "file_body_test_missing.txt", "gzip", res, ec);
+            BOOST_TEST(ec.failed());
+        }
+
+        std::remove(path.c_str());
+        std::remove((path + ".gz").c_str());
+        std::remove((path + ".br").c_str());
+    }
+
+    void
+    testWrite()
+    {
+        std::string const path =
+            "file_body_test_write.txt";
+        std::string const contents =
+            "0123456789abcdefghijklmnopqrstuvwxyz";
+
+        // sequence beyond the size limit
+        {
+            system::error_code ec;
+            file f;
+            f.open(path.c_str(), file_mode::write, ec);
+            BOOST_TEST(! ec.failed());
+            file_body body(std::move(f), 12);
+            body.size_hint(100);
+            buffers::const_buffer cb[3] = {
+                { &contents[0], 5 },
+                { &contents[5], 5 },
+                { &contents[10], 5 } };
+            auto rv = body.write(
+                buffers::const_buffer_span(cb, 3), false);
+            BOOST_TEST(! rv.ec.failed());
+            BOOST_TEST_EQ(rv.bytes, 12u);
+        }
+        {
+            system::error_code ec;
+            file f;
+            f.open(path.c_str(), file_mode::scan, ec);
+            BOOST_TEST(! ec.failed());
+            BOOST_TEST_EQ(f.size(ec), 12u);
+        }
+
+        // upload with a known size
+        {
+            request_parser::config cfg;
+            cfg.min_buffer = 8;
+            context ctx;
+            install_parser_service(ctx, cfg);
+            request_parser pr(ctx);
+            pr.reset();
+            pr.start();
+
+            std::string msg =
+                "POST / HTTP/1.1\r\n"
+                "Content-Length: 36\r\n"
+                "\r\n" + contents;
+            core::string_view in = msg;
+            bool attached = false;
+            for(;;)
+            {
+                system::error_code ec;
+                pr.parse(ec);
+                if(! attached && pr.got_header())
+                {
+                    system::error_code ec1;
+                    file f;
+                    f.open(path.c_str(), file_mode::write, ec1);
+                    BOOST_TEST(! ec1.failed());
+                    pr.set_body<file_body>(std::move(f));
+                    attached = true;
+                    continue;
+                }
+                if(ec == condition::need_more_input)
+                {
+                    if(! BOOST_TEST(! in.empty()))
+                        break;
+                    auto n = buffers::buffer_copy(
+                        pr.prepare(),
+                        buffers::make_buffer(
+                            in.data(), in.size()));
+                    pr.commit(n);
+                    in.remove_prefix(n);
+                    continue;
+                }
+                BOOST_TEST(! ec.failed());
+                break;
+            }
+            BOOST_TEST(pr.is_complete());
+        }
+        {
+            system::error_code ec;
+            file f;
+            f.open(path.c_str(), file_mode::scan, ec);
+            BOOST_TEST(! ec.failed());
+            std::string s(contents.size() + 1, 0);
+            auto n = f.read(&s[0], s.size(), ec);
+            BOOST_TEST(! ec.failed());
+            s.resize(n);
+            BOOST_TEST_EQ(s, contents);
+        }
+
+        std::remove(path.c_str());
+    }
+
+    void
+    testDirect()
+    {
+        std::string const path =
+            "file_body_test_direct.txt";
+        std::string contents;
+        for(std::size_t i = 0; i < 20000; ++i)
+            contents.push_back(
+                static_cast<char>('a' + i % 26));
+        create(path, contents);
+
+        auto const open = [&](
+            std::uint64_t pos,
+            std::uint64_t size,
+            bool& supported)
+        {
+            system::error_code ec;
+            file f;
+            f.open(path.c_str(), file_mode::scan, ec);
+            BOOST_TEST(! ec.failed());
+            f.seek(pos, ec);
+            BOOST_TEST(! ec.failed());
+            file_body body(std::move(f), size);
+            body.set_direct(8192, ec);
+            // not every file system supports it
+            supported = ! ec.failed();
+            return body;
+        };
+
+        // unaligned start and limit
+        {
+            bool supported;
+            auto body = open(5, 9000, supported);
+            if(! supported)
+            {
+                std::remove(path.c_str());
+                return;
+            }
+            BOOST_TEST_EQ(read_all(body),
+                contents.substr(5, 9000));
+        }
+
+        // rest of the file
+        {
+            bool supported;
+            auto body = open(4096, std::uint64_t(-1), supported);
+            BOOST_TEST_EQ(read_all(body),
+                contents.substr(4096));
+        }
+
+        // aligned destination
+        {
+            bool supported;
+            auto body = open(0, std::uint64_t(-1), supported);
+            std::unique_ptr<char[]> up(new char[65536]);
+            void* p = up.get();
+            std::size_t space = 65536;
+            std::align(4096, 32768, p, space);
+            std::string s;
+            for(;;)
+            {
+                auto rs = body.read(
+                    buffers::make_buffer(p, 32768));
+                BOOST_TEST(! rs.ec.failed());
+                s.append(static_cast<
+                    char const*>(p), rs.bytes);
+                if(rs.finished || rs.ec.failed())
+                    break;
+            }
+            BOOST_TEST_EQ(s, contents);
+        }
+
+        std::remove(path.c_str());
+    }
+
     void
     run()
     {
+        testPrecompressed();
+        testWrite();
+        testDirect();
     }
 };
 
@@ -0,0 +1,149 @@
+//
+// Copyright (c) 2026 agent (agent@local)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/cppalliance/http_proto
+//
+
+// Test that header file is self-contained.
+#include <boost/http_proto/file_mmap.hpp>
+
+#if BOOST_HTTP_PROTO_USE_POSIX_FILE
+
+#include <boost/http_proto/response.hpp>
+#include <boost/http_proto/serializer.hpp>
+#include <boost/buffers/buffer_copy.hpp>
+#include <boost/buffers/buffer_size.hpp>
+#include <boost/buffers/make_buffer.hpp>
+
+#include "test_helpers.hpp"
+
+#include <algorithm>
+#include <cstdio>
+#include <string>
+
+namespace boost {
+namespace http_proto {
+
+struct file_mmap_test
+{
+    std::string const path_ =
+        "file_mmap_test.bin";
+
+    file_posix
+    open_file(std::uint64_t pos = 0)
+    {
+        system::error_code ec;
+        file_posix f;
+        f.open(path_.c_str(), file_mode::scan, ec);
+        BOOST_TEST(! ec.failed());
+        f.seek(pos, ec);
+        BOOST_TEST(! ec.failed());
+        return f;
+    }
+
+    static
+    std::string
+    read(serializer& sr)
+    {
+        std::string s;
+        while(! sr.is_done())
+        {
+            auto cbs = sr.prepare().value();
+            // consume in odd sizes, to
+            // straddle page boundaries
+            auto const n = (std::min)(
+                buffers::buffer_size(cbs),
+                std::size_t(3001));
+            std::string tmp(n, 0);
+            buffers::buffer_copy(
+                buffers::make_buffer(&tmp[0], n), cbs);
+            s += tmp;
+            sr.consume(n);
+        }
+        return s;
+    }
+
+    void
+    testMmap()
+    {
+        // more than a few pages
+        auto const contents =
+            test_contents(100000);
+        {
+            system::error_code ec;
+            file_posix f;
+            f.open(path_.c_str(), file_mode::write, ec);
+            BOOST_TEST(! ec.failed());
+            f.write(contents.data(), contents.size(), ec);
+            BOOST_TEST(! ec.failed());
+        }
+
+        context ctx;
+        serializer sr(ctx);
+
+        // whole file, several windows
+        {
+            response res;
+            res.set_content_length(contents.size());
+            sr.reset();
+            sr.start_view<file_mmap>(
+                res, open_file(), std::uint64_t(-1),
+                std::size_t(8192));
+            auto const s = read(sr);
+            BOOST_TEST(core::string_view(s).ends_with(
+                "\r\n\r\n" + contents));
+        }
+
+        // a range starting at an
+        // unaligned offset, chunked
+        {
+            response res;
+            res.set_chunked(true);
+            sr.reset();
+            sr.start_view<file_mmap>(
+                res, open_file(5000), 60000);
+            auto const s = read(sr);
+            auto const body =
+                contents.substr(5000, 60000);
+            BOOST_TEST(core::string_view(s).ends_with(
+                "\r\n\r\n"
+                "000000000000EA60\r\n" +
+                body +
+                "\r\n"
+                "0\r\n\r\n"));
+        }
+
+        // empty file range
+        {
+            response res;
+            res.set_chunked(true);
+            sr.reset();
+            sr.start_view<file_mmap>(
+                res, open_file(contents.size()));
+            auto const s = read(sr);
+            BOOST_TEST(core::string_view(s).ends_with(
+                "\r\n\r\n"
+                "0\r\n\r\n"));
+        }
+
+        std::remove(path_.c_str());
+    }
+
+    void
+    run()
+    {
+        testMmap();
+    }
+};
+
+TEST_SUITE(
+    file_mmap_test,
+    "boost.http_proto.file_mmap");
+
+} // http_proto
+} // boost
+
+#endif
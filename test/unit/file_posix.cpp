@@ -15,16 +15,48 @@
 #include "file_test.hpp"
 #include "test_suite.hpp"
 
+#include <cstdio>
+#include <string>
+
 namespace boost {
 namespace http_proto {
 
 class file_posix_test
 {
 public:
+    void
+    testDirect()
+    {
+        std::string const path =
+            "file_posix_test_direct.txt";
+        system::error_code ec;
+        file_posix f;
+        BOOST_TEST(! f.is_direct());
+        f.set_direct(true, ec);
+        BOOST_TEST(ec == system::errc::bad_file_descriptor);
+
+        f.open(path.c_str(), file_mode::write, ec);
+        BOOST_TEST(! ec.failed());
+        f.set_direct(true, ec);
+        if(! ec.failed())
+        {
+            BOOST_TEST(f.is_direct());
+            f.set_direct(false, ec);
+            BOOST_TEST(! ec.failed());
+            BOOST_TEST(! f.is_direct());
+            f.set_direct(true, ec);
+            BOOST_TEST(! ec.failed());
+        }
+        f.close(ec);
+        BOOST_TEST(! f.is_direct());
+        std::remove(path.c_str());
+    }
+
     void
     run()
     {
         test_file<file_posix>();
+        testDirect();
     }
 };
 
@@ -0,0 +1,34 @@
+//
+// Copyright (c) 2026 agent (agent@local)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/cppalliance/http_proto
+//
+
+// Test that header file is self-contained.
+#include <boost/http_proto/file_region.hpp>
+
+#include "test_suite.hpp"
+
+namespace boost {
+namespace http_proto {
+
+struct file_region_test
+{
+    void
+    run()
+    {
+        file_region r{};
+        BOOST_TEST_EQ(r.offset, 0u);
+        BOOST_TEST_EQ(r.size, 0u);
+    }
+};
+
+TEST_SUITE(
+    file_region_test,
+    "boost.http_proto.file_region");
+
+} // http_proto
+} // boost
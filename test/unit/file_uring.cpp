@@ -0,0 +1,126 @@
+//
+// Copyright (c) 2026 agent (agent@local)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/cppalliance/http_proto
+//
+
+// Test that header file is self-contained.
+#include <boost/http_proto/file_uring.hpp>
+
+#if BOOST_HTTP_PROTO_USE_IO_URING
+
+#include <boost/system/system_error.hpp>
+#include <boost/static_assert.hpp>
+
+#include "test_suite.hpp"
+
+#include <cstdio>
+#include <stdexcept>
+#include <string>
+
+namespace boost {
+namespace http_proto {
+
+struct file_uring_test
+{
+    struct op
+        : uring_service::operation
+    {
+        int res = -1;
+
+        void
+        on_complete(int res_) noexcept override
+        {
+            res = res_;
+        }
+    };
+
+    void
+    run()
+    {
+        BOOST_STATIC_ASSERT(
+            is_file<file_uring>::value);
+
+        context ctx;
+        BOOST_TEST_THROWS(
+            file_uring{ ctx },
+            std::invalid_argument);
+        try
+        {
+            install_uring_service(ctx);
+        }
+        catch(system::system_error const&)
+        {
+            // io_uring is unavailable
+            return;
+        }
+
+        std::string const path =
+            "file_uring_test.txt";
+        system::error_code ec;
+
+        // closed
+        {
+            file_uring f(ctx);
+            BOOST_TEST(! f.is_open());
+            char buf[1];
+            f.read(buf, 1, ec);
+            BOOST_TEST(ec.failed());
+            f.write(buf, 1, ec);
+            BOOST_TEST(ec.failed());
+        }
+
+        // write, then read back
+        {
+            file_uring f(ctx);
+            f.open(path.c_str(), file_mode::write, ec);
+            BOOST_TEST(! ec.failed());
+            BOOST_TEST(f.is_open());
+            BOOST_TEST_EQ(f.write("Hello, ", 7, ec), 7u);
+            BOOST_TEST(! ec.failed());
+            BOOST_TEST_EQ(f.write("world!", 6, ec), 6u);
+            BOOST_TEST(! ec.failed());
+            BOOST_TEST_EQ(f.pos(ec), 13u);
+            BOOST_TEST_EQ(f.size(ec), 13u);
+
+            f.seek(7, ec);
+            BOOST_TEST(! ec.failed());
+            char buf[16] = {};
+            BOOST_TEST_EQ(f.read(buf, sizeof(buf), ec), 6u);
+            BOOST_TEST(! ec.failed());
+            BOOST_TEST_EQ(std::string(buf), "world!");
+            f.close(ec);
+            BOOST_TEST(! ec.failed());
+        }
+
+        // asynchronous read
+        {
+            file_posix fp;
+            fp.open(path.c_str(), file_mode::scan, ec);
+            BOOST_TEST(! ec.failed());
+            file_uring f(ctx, std::move(fp));
+            char buf[5] = {};
+            op r;
+            f.async_read(buf, sizeof(buf), r);
+            BOOST_TEST_EQ(f.service().run_one(), 1u);
+            BOOST_TEST_EQ(r.res, 5);
+            BOOST_TEST_EQ(
+                std::string(buf, 5), "Hello");
+            BOOST_TEST_EQ(f.pos(ec), 5u);
+        }
+
+        std::remove(path.c_str());
+    }
+};
+
+TEST_SUITE(
+    file_uring_test,
+    "boost.http_proto.file_uring");
+
+} // http_proto
+} // boost
+
+#endif
@@ -0,0 +1,135 @@
+//
+// Copyright (c) 2026 agent (agent@local)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/cppalliance/http_proto
+//
+
+// Test that header file is self-contained.
+#include <boost/http_proto/generator_source.hpp>
+
+#if BOOST_HTTP_PROTO_HAS_COROUTINES
+
+#include <boost/http_proto/response.hpp>
+#include <boost/http_proto/serializer.hpp>
+
+#include "test_helpers.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+
+namespace boost {
+namespace http_proto {
+
+struct generator_source_test
+{
+    static
+    generator_source::body
+    repeat(std::string s, int n)
+    {
+        for(int i = 0; i < n; ++i)
+            co_yield buffers::const_buffer(
+                s.data(), s.size());
+    }
+
+    static
+    generator_source::body
+    fill(char c, std::size_t n)
+    {
+        while(n > 0)
+        {
+            auto b = co_await
+                generator_source::prepare();
+            BOOST_TEST_GT(b.size(), 0u);
+            auto const m =
+                (std::min)(n, b.size());
+            std::memset(b.data(), c, m);
+            co_yield generator_source::commit(m);
+            n -= m;
+        }
+    }
+
+    static
+    generator_source::body
+    fail()
+    {
+        co_yield buffers::const_buffer("ab", 2);
+        throw std::runtime_error("fail");
+    }
+
+    void
+    testGenerator()
+    {
+        context ctx;
+        serializer sr(ctx);
+
+        // copied from yielded buffers
+        {
+            response res;
+            res.set_content_length(6000);
+            sr.reset();
+            sr.start<generator_source>(
+                res, repeat("Hello\n", 1000));
+            std::string body;
+            for(int i = 0; i < 1000; ++i)
+                body += "Hello\n";
+            BOOST_TEST_EQ(test_serialize(sr),
+                std::string(res.buffer()) + body);
+        }
+
+        // written in place
+        {
+            response res;
+            res.set_content_length(100000);
+            sr.reset();
+            sr.start<generator_source>(
+                res, fill('x', 100000));
+            BOOST_TEST_EQ(test_serialize(sr),
+                std::string(res.buffer()) +
+                std::string(100000, 'x'));
+        }
+
+        // empty
+        {
+            response res;
+            res.set_chunked(true);
+            sr.reset();
+            sr.start<generator_source>(
+                res, repeat("", 0));
+            BOOST_TEST_EQ(test_serialize(sr),
+                std::string(res.buffer()) +
+                "0\r\n\r\n");
+        }
+
+        // exception
+        {
+            response res;
+            res.set_chunked(true);
+            sr.reset();
+            sr.start<generator_source>(
+                res, fail());
+            BOOST_TEST_THROWS(
+                sr.prepare(),
+                std::runtime_error);
+        }
+    }
+
+    void
+    run()
+    {
+        testGenerator();
+    }
+};
+
+TEST_SUITE(
+    generator_source_test,
+    "boost.http_proto.generator_source");
+
+} // http_proto
+} // boost
+
+#endif
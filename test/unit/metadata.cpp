@@ -302,6 +302,20 @@ struct metadata_test
             [](message_base&){},
             { ok, 1, encoding::gzip });
 
+        check(
+            "GET / HTTP/1.1\r\n"
+            "Content-Encoding: br\r\n"
+            "\r\n",
+            [](message_base&){},
+            { ok, 1, encoding::br });
+
+        check(
+            "GET / HTTP/1.1\r\n"
+            "Content-Encoding: ZSTD\r\n"
+            "\r\n",
+            [](message_base&){},
+            { ok, 1, encoding::zstd });
+
         check(
             "GET / HTTP/1.1\r\n"
             "Content-Encoding: gzip, deflate\r\n"
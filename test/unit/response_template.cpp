@@ -0,0 +1,164 @@
+//
+// Copyright (c) 2026 agent (agent@local)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/cppalliance/http_proto
+//
+
+// Test that header file is self-contained.
+#include <boost/http_proto/response_template.hpp>
+
+#include <boost/http_proto/field.hpp>
+
+#include <stdexcept>
+
+#include "test_suite.hpp"
+
+namespace boost {
+namespace http_proto {
+
+struct response_template_test
+{
+    static
+    response
+    make_response()
+    {
+        response res;
+        res.set(field::server, "Boost");
+        res.set(field::date, "Thu, 01 Jan 1970 00:00:00 GMT");
+        res.set(field::content_type, "text/html");
+        res.set(field::transfer_encoding, "chunked");
+        return res;
+    }
+
+    void
+    testTemplate()
+    {
+        response_template const tpl(
+            make_response(), {
+                { "Content-Length", 4 },
+                { "Date", 29 },
+                { "X-Request-Id", 8 } });
+
+        BOOST_TEST_EQ(tpl.size(), 3u);
+        BOOST_TEST_EQ(tpl.get().buffer(),
+            "HTTP/1.1 200 OK\r\n"
+            "Server: Boost\r\n"
+            "Content-Type: text/html\r\n"
+            "Content-Length:    0\r\n"
+            "Date:                             0\r\n"
+            "X-Request-Id:        0\r\n"
+            "\r\n");
+        BOOST_TEST(tpl.get().payload() == payload::size);
+        BOOST_TEST_EQ(tpl.get().payload_size(), 0u);
+
+        response res;
+        tpl.apply(res);
+        BOOST_TEST_EQ(res.buffer(), tpl.get().buffer());
+
+        tpl.set(res, 0, std::uint64_t(42));
+        tpl.set(res, 1, "Sun, 06 Nov 1994 08:49:37 GMT");
+        tpl.set(res, 2, "abc");
+        BOOST_TEST_EQ(res.buffer(),
+            "HTTP/1.1 200 OK\r\n"
+            "Server: Boost\r\n"
+            "Content-Type: text/html\r\n"
+            "Content-Length:   42\r\n"
+            "Date: Sun, 06 Nov 1994 08:49:37 GMT\r\n"
+            "X-Request-Id:      abc\r\n"
+            "\r\n");
+        BOOST_TEST_EQ(
+            res.value_or(field::content_length, ""), "42");
+        BOOST_TEST_EQ(
+            res.value_or(field::date, ""),
+            "Sun, 06 Nov 1994 08:49:37 GMT");
+        BOOST_TEST_EQ(
+            res.value_or("X-Request-Id", ""), "abc");
+        BOOST_TEST(res.payload() == payload::size);
+        BOOST_TEST_EQ(res.payload_size(), 42u);
+        BOOST_TEST_EQ(
+            res.metadata().content_length.value, 42u);
+
+        // a slot may be set again
+        tpl.set(res, 0, "1000");
+        tpl.set(res, 2, "");
+        BOOST_TEST_EQ(
+            res.value_or(field::content_length, ""), "1000");
+        BOOST_TEST_EQ(
+            res.value_or("X-Request-Id", "-"), "");
+        BOOST_TEST_EQ(res.payload_size(), 1000u);
+
+        // reuse the allocation
+        auto const p = res.buffer().data();
+        tpl.apply(res);
+        BOOST_TEST_EQ(res.buffer(), tpl.get().buffer());
+        BOOST_TEST(res.buffer().data() == p);
+        BOOST_TEST_EQ(res.payload_size(), 0u);
+    }
+
+    void
+    testErrors()
+    {
+        BOOST_TEST_THROWS(
+            response_template(make_response(),
+                { { "Transfer-Encoding", 8 } }),
+            std::invalid_argument);
+        BOOST_TEST_THROWS(
+            response_template(make_response(),
+                { { "X-Id", 0 } }),
+            std::invalid_argument);
+
+        response_template const tpl(
+            make_response(), {
+                { "Content-Length", 4 },
+                { "X-Request-Id", 8 } });
+        response res;
+        tpl.apply(res);
+
+        BOOST_TEST_THROWS(
+            tpl.set(res, 1, "123456789"),
+            std::length_error);
+        BOOST_TEST_THROWS(
+            tpl.set(res, 0, std::uint64_t(12345)),
+            std::length_error);
+        BOOST_TEST_THROWS(
+            tpl.set(res, 2, "1"),
+            std::invalid_argument);
+        BOOST_TEST_THROWS(
+            tpl.set(res, 0, "abc"),
+            std::invalid_argument);
+        BOOST_TEST_THROWS(
+            tpl.set(res, 1, "a\r\nb"),
+            std::invalid_argument);
+        BOOST_TEST_THROWS(
+            tpl.set(res, 1, " a"),
+            std::invalid_argument);
+        BOOST_TEST_EQ(res.buffer(), tpl.get().buffer());
+
+        // not assigned from the template
+        response res2;
+        BOOST_TEST_THROWS(
+            tpl.set(res2, 0, "1"),
+            std::invalid_argument);
+        res.set(field::server, "Boost.HTTP");
+        BOOST_TEST_THROWS(
+            tpl.set(res, 0, "1"),
+            std::invalid_argument);
+    }
+
+    void
+    run()
+    {
+        testTemplate();
+        testErrors();
+    }
+};
+
+TEST_SUITE(
+    response_template_test,
+    "boost.http_proto.response_template");
+
+} // http_proto
+} // boost
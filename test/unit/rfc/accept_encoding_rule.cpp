@@ -0,0 +1,78 @@
+//
+// Copyright (c) 2026 agent (agent@local)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/cppalliance/http_proto
+//
+
+// Test that header file is self-contained.
+#include "../../src/rfc/accept_encoding_rule.hpp"
+
+#include <boost/url/grammar/parse.hpp>
+
+#include "test_helpers.hpp"
+
+namespace boost {
+namespace http_proto {
+
+struct accept_encoding_rule_test
+{
+    void
+    check(
+        core::string_view s,
+        core::string_view coding,
+        unsigned short q)
+    {
+        auto rv = grammar::parse(
+            s, detail::accept_encoding_rule_impl);
+        if(! BOOST_TEST(rv.has_value()))
+            return;
+        BOOST_TEST_EQ(rv->coding, coding);
+        BOOST_TEST_EQ(rv->q, q);
+    }
+
+    void
+    run()
+    {
+        auto const& t =
+            detail::accept_encoding_rule;
+
+        ok(t,  "");
+        ok(t,  "gzip");
+        ok(t,  "gzip, deflate, br");
+        ok(t,  "gzip, deflate, br, zstd");
+        ok(t,  "*");
+        ok(t,  "identity;q=0");
+        ok(t,  "br;q=1.0, gzip;q=0.8, *;q=0.1");
+        ok(t,  "br ; q=1.000");
+        ok(t,  "gzip;Q=0.5");
+        ok(t,  "gzip,,deflate");
+        bad(t, "gzip;");
+        bad(t, "gzip;q");
+        bad(t, "gzip;q=");
+        bad(t, "gzip;q=2");
+        bad(t, "gzip;q=1.5");
+        bad(t, "gzip;q=0.1234");
+        bad(t, "gzip;level=5");
+        bad(t, "gzip deflate");
+
+        check("gzip", "gzip", 1000);
+        check("gzip;q=0", "gzip", 0);
+        check("gzip;q=0.", "gzip", 0);
+        check("gzip;q=0.5", "gzip", 500);
+        check("gzip;q=0.05", "gzip", 50);
+        check("gzip;q=0.123", "gzip", 123);
+        check("gzip;q=1", "gzip", 1000);
+        check("gzip;q=1.00", "gzip", 1000);
+        check("*;q=0.001", "*", 1);
+    }
+};
+
+TEST_SUITE(
+    accept_encoding_rule_test,
+    "boost.http_proto.accept_encoding_rule");
+
+} // http_proto
+} // boost
@@ -0,0 +1,149 @@
+//
+// Copyright (c) 2026 agent (agent@local)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/cppalliance/http_proto
+//
+
+// Test that header file is self-contained.
+#include <boost/http_proto/rfc/range_rule.hpp>
+
+#include "test_rule.hpp"
+
+#include <string>
+
+namespace boost {
+namespace http_proto {
+
+struct range_rule_test
+{
+    // ranges as "offset+size,..."
+    static
+    std::string
+    format(
+        byte_range const* r,
+        std::size_t n)
+    {
+        std::string s;
+        for(std::size_t i = 0; i < n; ++i)
+        {
+            if(i > 0)
+                s.push_back(',');
+            s += std::to_string(r[i].offset);
+            s.push_back('+');
+            s += std::to_string(r[i].size);
+        }
+        return s;
+    }
+
+    static
+    void
+    check(
+        core::string_view s,
+        std::uint64_t length,
+        core::string_view expected)
+    {
+        byte_range r[4];
+        auto rv = satisfiable_ranges(s, length, r, 4);
+        if(! BOOST_TEST(rv.has_value()))
+            return;
+        BOOST_TEST_EQ(format(r, *rv), expected);
+    }
+
+    void
+    testRule()
+    {
+        auto const& t = range_rule;
+
+        ok(t,  "bytes=0-499");
+        ok(t,  "bytes=500-");
+        ok(t,  "bytes=-500");
+        ok(t,  "BYTES=0-0");
+        ok(t,  "bytes=0-0,-1");
+        ok(t,  "bytes=500-600, 601-999");
+        ok(t,  "bytes=0-18446744073709551615");
+        bad(t, "");
+        bad(t, "bytes");
+        bad(t, "bytes=");
+        bad(t, "bytes=-");
+        bad(t, "bytes=a-b");
+        bad(t, "bytes=5-4");
+        bad(t, "bytes=0-1;");
+        bad(t, "bytes =0-1");
+        bad(t, "items=0-1");
+        bad(t, "bytes=0-18446744073709551616");
+
+        auto rv = grammar::parse(
+            "bytes=2-7, -3, 4-", range_rule);
+        if(BOOST_TEST(rv.has_value()))
+        {
+            auto it = rv->begin();
+            BOOST_TEST_EQ(it->first, 2u);
+            BOOST_TEST_EQ(it->last, 7u);
+            BOOST_TEST(! it->is_suffix);
+            ++it;
+            BOOST_TEST_EQ(it->first, 3u);
+            BOOST_TEST(it->is_suffix);
+            ++it;
+            BOOST_TEST_EQ(it->first, 4u);
+            BOOST_TEST_EQ(it->last, std::uint64_t(-1));
+            BOOST_TEST(! it->is_suffix);
+            ++it;
+            BOOST_TEST(it == rv->end());
+        }
+    }
+
+    void
+    testSatisfiable()
+    {
+        check("bytes=0-499", 10000, "0+500");
+        check("bytes=500-999", 10000, "500+500");
+        check("bytes=-500", 10000, "9500+500");
+        check("bytes=9500-", 10000, "9500+500");
+        check("bytes=0-0,-1", 10000, "0+1,9999+1");
+        check("bytes=0-99999", 10000, "0+10000");
+        check("bytes=-99999", 10000, "0+10000");
+
+        // unsatisfiable
+        check("bytes=10000-", 10000, "");
+        check("bytes=-0", 10000, "");
+        check("bytes=0-10", 0, "");
+        check("bytes=20000-, 0-9", 10000, "0+10");
+
+        // coalescing
+        check("bytes=0-9, 5-14", 100, "0+15");
+        check("bytes=0-9, 10-19", 100, "0+20");
+        check("bytes=50-59, 0-9, 20-29, 5-55", 100, "0+60");
+        check("bytes=50-59, 0-9, 20-29, 25-52", 100, "20+40,0+10");
+        check("bytes=50-59, 0-9, 20-29, 40-45", 100, "50+10,0+10,20+10,40+6");
+        check("bytes=0-0, 0-0, 0-0, 0-0, 0-0", 100, "0+1");
+
+        // invalid
+        {
+            byte_range r[4];
+            BOOST_TEST(satisfiable_ranges(
+                "bytes=1-0", 100, r, 4).has_error());
+            BOOST_TEST(satisfiable_ranges(
+                "pages=1-2", 100, r, 4).has_error());
+            BOOST_TEST(satisfiable_ranges(
+                "bytes=0-0,2-2,4-4,6-6,8-8",
+                100, r, 4).has_error());
+        }
+    }
+
+    void
+    run()
+    {
+        testRule();
+        testSatisfiable();
+    }
+};
+
+TEST_SUITE(
+    range_rule_test,
+    "boost.http_proto.range_rule");
+
+} // http_proto
+} // boost
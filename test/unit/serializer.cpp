@@ -11,8 +11,10 @@
 // Test that header file is self-contained.
 #include <boost/http_proto/serializer.hpp>
 
+#include <boost/http_proto/fields.hpp>
 #include <boost/http_proto/response.hpp>
 #include <boost/http_proto/string_body.hpp>
+#include <boost/http_proto/rfc/range_rule.hpp>
 #include <boost/buffers/algorithm.hpp>
 #include <boost/buffers/buffer_copy.hpp>
 #include <boost/buffers/buffer_size.hpp>
@@ -22,10 +24,17 @@
 #include <boost/core/ignore_unused.hpp>
 #include "test_helpers.hpp"
 
+#include <algorithm>
+#include <iterator>
 #include <array>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
 #include <stdexcept>
 #include <string>
+#include <thread>
 #include <vector>
+#include <limits.h>
 
 #ifdef BOOST_HTTP_PROTO_HAS_ZLIB
 #include <zlib.h>
@@ -816,6 +825,1230 @@ struct serializer_test
         }
     }
 
+    void
+    testFileRegion()
+    {
+        // the "file" is a string, and bytes
+        // are sent from it in small pieces
+        std::string const file =
+            "0123456789abcdefghijklmnopqrstuvwxyz";
+
+        auto const serialize = [&](
+            serializer& sr)
+        {
+            std::string out;
+            while(! sr.is_done() )
+            {
+                auto r = sr.region();
+                if( r.size > 0 )
+                {
+                    auto const n = (std::min)(
+                        std::size_t(r.size), std::size_t(7));
+                    out.append(
+                        file.data() + r.offset, n);
+                    sr.consume(n);
+                    continue;
+                }
+                auto cbs = sr.prepare().value();
+                auto const n = (std::min)(
+                    buffers::buffer_size(cbs),
+                    std::size_t(5));
+                BOOST_TEST_GT(n, 0);
+                std::string s(n, 0);
+                buffers::buffer_copy(
+                    buffers::make_buffer(&s[0], n), cbs);
+                out += s;
+                sr.consume(n);
+            }
+            return out;
+        };
+
+        context ctx;
+        serializer sr(ctx);
+
+        {
+            response res(
+                "HTTP/1.1 200 OK\r\n"
+                "Content-Length: 26\r\n"
+                "\r\n");
+            file_region r{};
+            r.offset = 10;
+            r.size = 26;
+            sr.reset();
+            sr.start(res, r);
+            BOOST_TEST_EQ(sr.region().size, 0u);
+            BOOST_TEST_EQ(
+                serialize(sr),
+                "HTTP/1.1 200 OK\r\n"
+                "Content-Length: 26\r\n"
+                "\r\n"
+                "abcdefghijklmnopqrstuvwxyz");
+        }
+
+        {
+            response res(
+                "HTTP/1.1 200 OK\r\n"
+                "Transfer-Encoding: chunked\r\n"
+                "\r\n");
+            file_region r{};
+            r.size = 10;
+            sr.reset();
+            sr.start(res, r);
+            BOOST_TEST_EQ(
+                serialize(sr),
+                "HTTP/1.1 200 OK\r\n"
+                "Transfer-Encoding: chunked\r\n"
+                "\r\n"
+                "000000000000000A\r\n"
+                "0123456789"
+                "\r\n"
+                "0\r\n\r\n");
+        }
+
+        // empty region
+        {
+            response res(
+                "HTTP/1.1 200 OK\r\n"
+                "Transfer-Encoding: chunked\r\n"
+                "\r\n");
+            sr.reset();
+            sr.start(res, file_region{});
+            BOOST_TEST_EQ(
+                serialize(sr),
+                "HTTP/1.1 200 OK\r\n"
+                "Transfer-Encoding: chunked\r\n"
+                "\r\n"
+                "0\r\n\r\n");
+        }
+
+        // consuming past the region
+        {
+            response res;
+            file_region r{};
+            r.size = 3;
+            sr.reset();
+            sr.start(res, r);
+            sr.consume(buffers::buffer_size(
+                sr.prepare().value()));
+            BOOST_TEST_EQ(sr.region().size, 3u);
+            BOOST_TEST_THROWS(
+                sr.consume(4),
+                std::invalid_argument);
+        }
+    }
+
+    void
+    testRanges()
+    {
+        // the representation is the letters
+        std::string const file =
+            "0123456789abcdefghijklmnopqrstuvwxyz";
+        file_region f{};
+        f.offset = 10;
+        f.size = 26;
+
+        auto const serialize = [&](
+            serializer& sr)
+        {
+            std::string out;
+            while(! sr.is_done() )
+            {
+                auto r = sr.region();
+                if( r.size > 0 )
+                {
+                    auto const n = (std::min)(
+                        std::size_t(r.size), std::size_t(2));
+                    out.append(
+                        file.data() + r.offset, n);
+                    sr.consume(n);
+                    continue;
+                }
+                auto cbs = sr.prepare().value();
+                auto const n = (std::min)(
+                    buffers::buffer_size(cbs),
+                    std::size_t(7));
+                BOOST_TEST_GT(n, 0);
+                std::string s(n, 0);
+                buffers::buffer_copy(
+                    buffers::make_buffer(&s[0], n), cbs);
+                out += s;
+                sr.consume(n);
+            }
+            return out;
+        };
+
+        context ctx;
+        serializer sr(ctx);
+        byte_range r[4];
+
+        // one range
+        {
+            response res;
+            res.set(field::content_type, "text/plain");
+            auto rv = satisfiable_ranges(
+                "bytes=10-15", f.size, r, 4);
+            BOOST_TEST_EQ(rv.value(), 1u);
+            sr.reset();
+            sr.start_ranges(res, f, r, *rv);
+            BOOST_TEST_EQ(
+                serialize(sr),
+                "HTTP/1.1 206 Partial Content\r\n"
+                "Content-Type: text/plain\r\n"
+                "Content-Range: bytes 10-15/26\r\n"
+                "Content-Length: 6\r\n"
+                "\r\n"
+                "klmnop");
+        }
+
+        // multipart/byteranges
+        {
+            response res;
+            res.set(field::content_type, "text/plain");
+            auto rv = satisfiable_ranges(
+                "bytes=0-2, -3", f.size, r, 4);
+            BOOST_TEST_EQ(rv.value(), 2u);
+            sr.reset();
+            sr.start_ranges(res, f, r, *rv);
+
+            core::string_view const type =
+                "multipart/byteranges; boundary=";
+            auto ct = res.value_or(
+                field::content_type, "");
+            BOOST_TEST(ct.starts_with(type));
+            auto const b = std::string(
+                ct.substr(type.size()));
+            BOOST_TEST(! b.empty());
+
+            std::string const body =
+                "--" + b + "\r\n"
+                "Content-Type: text/plain\r\n"
+                "Content-Range: bytes 0-2/26\r\n"
+                "\r\n"
+                "abc"
+                "\r\n--" + b + "\r\n"
+                "Content-Type: text/plain\r\n"
+                "Content-Range: bytes 23-25/26\r\n"
+                "\r\n"
+                "xyz"
+                "\r\n--" + b + "--\r\n";
+            BOOST_TEST_EQ(
+                serialize(sr),
+                "HTTP/1.1 206 Partial Content\r\n"
+                "Content-Type: multipart/byteranges; "
+                    "boundary=" + b + "\r\n"
+                "Content-Length: " +
+                    std::to_string(body.size()) + "\r\n"
+                "\r\n" + body);
+        }
+
+        // not satisfiable
+        {
+            response res;
+            auto rv = satisfiable_ranges(
+                "bytes=26-", f.size, r, 4);
+            BOOST_TEST_EQ(rv.value(), 0u);
+            sr.reset();
+            sr.start_ranges(res, f, r, *rv);
+            BOOST_TEST_EQ(
+                serialize(sr),
+                "HTTP/1.1 416 Range Not Satisfiable\r\n"
+                "Content-Range: bytes */26\r\n"
+                "Content-Length: 0\r\n"
+                "\r\n");
+        }
+
+        // chunked is removed
+        {
+            response res(
+                "HTTP/1.1 200 OK\r\n"
+                "Transfer-Encoding: chunked\r\n"
+                "\r\n");
+            r[0] = { 0, 3 };
+            sr.reset();
+            sr.start_ranges(res, f, r, 1);
+            BOOST_TEST_EQ(
+                serialize(sr),
+                "HTTP/1.1 206 Partial Content\r\n"
+                "Content-Range: bytes 0-2/26\r\n"
+                "Content-Length: 3\r\n"
+                "\r\n"
+                "abc");
+        }
+    }
+
+    struct test_view_source : view_source
+    {
+        // produces the data in pieces of at most n
+        test_view_source(
+            core::string_view s,
+            std::size_t n)
+            : s_(s)
+            , n_(n)
+        {
+        }
+
+        std::size_t released = 0;
+
+    private:
+        results
+        on_prepare() override
+        {
+            BOOST_TEST_EQ(pos_, released);
+            results rv;
+            auto const n = (std::min)(
+                n_, s_.size() - pos_);
+            rv.data = { s_.data() + pos_, n };
+            rv.finished = pos_ + n == s_.size();
+            pos_ += n;
+            return rv;
+        }
+
+        void
+        on_consume(std::size_t n) noexcept override
+        {
+            released += n;
+        }
+
+        core::string_view s_;
+        std::size_t n_;
+        std::size_t pos_ = 0;
+    };
+
+    void
+    testViewSource()
+    {
+        context ctx;
+        serializer sr(ctx);
+
+        {
+            response res(
+                "HTTP/1.1 200 OK\r\n"
+                "Content-Length: 26\r\n"
+                "\r\n");
+            sr.reset();
+            auto& src = sr.start_view<test_view_source>(
+                res, "abcdefghijklmnopqrstuvwxyz", 10);
+            BOOST_TEST_EQ(
+                read(sr),
+                "HTTP/1.1 200 OK\r\n"
+                "Content-Length: 26\r\n"
+                "\r\n"
+                "abcdefghijklmnopqrstuvwxyz");
+            BOOST_TEST_EQ(src.released, 26u);
+        }
+
+        {
+            response res(
+                "HTTP/1.1 200 OK\r\n"
+                "Transfer-Encoding: chunked\r\n"
+                "\r\n");
+            sr.reset();
+            auto& src = sr.start_view<test_view_source>(
+                res, "abcdefghijklmnopqrstuvwxyz", 20);
+            BOOST_TEST_EQ(
+                read(sr),
+                "HTTP/1.1 200 OK\r\n"
+                "Transfer-Encoding: chunked\r\n"
+                "\r\n"
+                "0000000000000014\r\n"
+                "abcdefghijklmnopqrst"
+                "\r\n"
+                "0000000000000006\r\n"
+                "uvwxyz"
+                "\r\n"
+                "0\r\n\r\n");
+            BOOST_TEST_EQ(src.released, 26u);
+        }
+
+        // empty body
+        {
+            response res(
+                "HTTP/1.1 200 OK\r\n"
+                "Transfer-Encoding: chunked\r\n"
+                "\r\n");
+            sr.reset();
+            sr.start_view<test_view_source>(res, "", 10);
+            BOOST_TEST_EQ(
+                read(sr),
+                "HTTP/1.1 200 OK\r\n"
+                "Transfer-Encoding: chunked\r\n"
+                "\r\n"
+                "0\r\n\r\n");
+        }
+    }
+
+    void
+    testBatch()
+    {
+        context ctx;
+        serializer sr(ctx);
+
+        // consume exactly n bytes
+        auto const take = [&](std::size_t n)
+        {
+            std::string s;
+            while( n > 0 )
+            {
+                auto cbs = sr.prepare().value();
+                auto const m = (std::min)(
+                    buffers::buffer_size(cbs), n);
+                std::string t(m, 0);
+                buffers::buffer_copy(
+                    buffers::make_buffer(&t[0], m), cbs);
+                s += t;
+                sr.consume(m);
+                n -= m;
+            }
+            return s;
+        };
+
+        {
+            response r1(
+                "HTTP/1.1 200 OK\r\n"
+                "Content-Length: 5\r\n"
+                "\r\n");
+            response r2(
+                "HTTP/1.1 204 No Content\r\n"
+                "\r\n");
+            response r3(
+                "HTTP/1.1 200 OK\r\n"
+                "Transfer-Encoding: chunked\r\n"
+                "\r\n");
+            response r4(
+                "HTTP/1.1 200 OK\r\n"
+                "Transfer-Encoding: chunked\r\n"
+                "\r\n");
+            std::array<buffers::const_buffer, 3> b3 = {{
+                buffers::const_buffer("ab", 2),
+                buffers::const_buffer(),
+                buffers::const_buffer("c", 1) }};
+
+            sr.reset();
+            sr.start(r1, buffers::const_buffer("hello", 5));
+            BOOST_TEST_EQ(sr.pending(), 1u);
+            sr.append(r2);
+            sr.append(r3, b3);
+            sr.append(r4);
+            BOOST_TEST_EQ(sr.pending(), 4u);
+
+            // a single gather write covers all
+            BOOST_TEST_EQ(
+                buffers::buffer_size(sr.prepare().value()),
+                r1.buffer().size() + 5 +
+                r2.buffer().size() +
+                r3.buffer().size() + 18 + 3 + 2 + 5 +
+                r4.buffer().size() + 5);
+
+            BOOST_TEST_EQ(
+                take(r1.buffer().size() + 4),
+                std::string(r1.buffer()) + "hell");
+            BOOST_TEST_EQ(sr.pending(), 4u);
+            BOOST_TEST_EQ(take(1), "o");
+            BOOST_TEST_EQ(sr.pending(), 3u);
+
+            // queue more while sending
+            sr.append(r2);
+            BOOST_TEST_EQ(sr.pending(), 4u);
+
+            BOOST_TEST_EQ(
+                take(r2.buffer().size()),
+                r2.buffer());
+            BOOST_TEST_EQ(sr.pending(), 3u);
+            BOOST_TEST_EQ(
+                read(sr),
+                std::string(r3.buffer()) +
+                "0000000000000003\r\nabc\r\n0\r\n\r\n" +
+                std::string(r4.buffer()) +
+                "0\r\n\r\n" +
+                std::string(r2.buffer()));
+            BOOST_TEST_EQ(sr.pending(), 0u);
+            BOOST_TEST(sr.is_done());
+
+            // not a batchable state
+            BOOST_TEST_THROWS(
+                sr.append(r2),
+                std::logic_error);
+            sr.reset();
+            sr.start<test_source>(r1, "hello");
+            BOOST_TEST_THROWS(
+                sr.append(r2),
+                std::logic_error);
+        }
+
+        // more messages than one gather write
+        {
+            serializer sr2(ctx, 256 * 1024);
+            response r(
+                "HTTP/1.1 204 No Content\r\n"
+                "\r\n");
+            std::size_t const n = 1100;
+            sr2.start(r);
+            for(std::size_t i = 1; i < n; ++i)
+                sr2.append(r);
+            BOOST_TEST_EQ(sr2.pending(), n);
+
+            auto cbs = sr2.prepare().value();
+#ifdef IOV_MAX
+            BOOST_TEST_LE(
+                static_cast<std::size_t>(
+                    std::distance(cbs.begin(), cbs.end())),
+                std::size_t(IOV_MAX));
+#endif
+            std::string expected;
+            for(std::size_t i = 0; i < n; ++i)
+                expected += r.buffer();
+            BOOST_TEST(read(sr2) == expected);
+            BOOST_TEST_EQ(sr2.pending(), 0u);
+        }
+    }
+
+    // produces up to `piece` bytes per read,
+    // then would block until read again
+    struct piece_source : source
+    {
+        piece_source(
+            core::string_view s,
+            std::size_t piece)
+            : s_(s)
+            , piece_(piece)
+        {
+        }
+
+        results
+        on_read(
+            buffers::mutable_buffer b) override
+        {
+            results rv;
+            auto n = (std::min)(piece_, s_.size());
+            rv.bytes = buffers::buffer_copy(
+                b, buffers::const_buffer(s_.data(), n));
+            s_.remove_prefix(rv.bytes);
+            rv.finished = s_.empty();
+            if( !rv.finished &&
+                rv.bytes < b.size() )
+                rv.ec = error::would_block;
+            return rv;
+        }
+
+    private:
+        core::string_view s_;
+        std::size_t piece_;
+    };
+
+    void
+    testCoalesce()
+    {
+        context ctx;
+        serializer sr(ctx);
+        response res(
+            "HTTP/1.1 200 OK\r\n"
+            "Transfer-Encoding: chunked\r\n"
+            "\r\n");
+        core::string_view const body =
+            "abcdefghijklmnopqrstuvwxyz";
+
+        // the source is always ready again
+        auto const serialize = [&](
+            std::size_t& blocked)
+        {
+            std::string s;
+            blocked = 0;
+            while(! sr.is_done() )
+            {
+                auto rv = sr.prepare();
+                if( rv.has_error() )
+                {
+                    BOOST_TEST(
+                        rv.error() == error::would_block);
+                    ++blocked;
+                    continue;
+                }
+                append(s, rv.value());
+                sr.consume(buffers::buffer_size(rv.value()));
+            }
+            return s;
+        };
+
+        // each piece is a chunk
+        {
+            std::size_t blocked;
+            sr.reset();
+            sr.start<piece_source>(res, body.substr(0, 6), 3);
+            BOOST_TEST_EQ(
+                serialize(blocked),
+                std::string(res.buffer()) +
+                "0000000000000003\r\nabc\r\n"
+                "0000000000000003\r\ndef\r\n"
+                "0\r\n\r\n");
+        }
+
+        // pieces are gathered into larger chunks
+        {
+            std::size_t blocked;
+            serializer::coalesce_options opt;
+            opt.min_size = 10;
+            sr.reset();
+            sr.coalesce_output(opt);
+            sr.start<piece_source>(res, body, 3);
+            BOOST_TEST_EQ(
+                serialize(blocked),
+                std::string(res.buffer()) +
+                "000000000000000C\r\nabcdefghijkl\r\n"
+                "000000000000000C\r\nmnopqrstuvwx\r\n"
+                "0000000000000002\r\nyz\r\n"
+                "0\r\n\r\n");
+            BOOST_TEST_EQ(blocked, 6u);
+
+            // not applied after reset
+            sr.reset();
+            sr.start<piece_source>(res, body, 3);
+            serialize(blocked);
+            BOOST_TEST_EQ(blocked, 0u);
+        }
+
+        // flush
+        {
+            serializer::coalesce_options opt;
+            opt.min_size = 100;
+            sr.reset();
+            sr.coalesce_output(opt);
+            sr.start<piece_source>(res, body, 3);
+            BOOST_TEST(sr.prepare().error() == error::would_block);
+            BOOST_TEST(sr.prepare().error() == error::would_block);
+            sr.flush();
+            auto cbs = sr.prepare().value();
+            std::string s;
+            append(s, cbs);
+            sr.consume(buffers::buffer_size(cbs));
+            BOOST_TEST_EQ(s,
+                std::string(res.buffer()) +
+                "0000000000000009\r\nabcdefghi\r\n");
+
+            // held again after the flush
+            BOOST_TEST(sr.prepare().error() == error::would_block);
+        }
+
+        // hold time
+        {
+            serializer::coalesce_options opt;
+            opt.min_size = 100;
+            opt.max_hold = std::chrono::nanoseconds(1);
+            sr.reset();
+            sr.coalesce_output(opt);
+            sr.start<piece_source>(res, body, 3);
+            BOOST_TEST(sr.prepare().error() == error::would_block);
+            auto cbs = sr.prepare().value();
+            std::string s;
+            append(s, cbs);
+            BOOST_TEST_EQ(s,
+                std::string(res.buffer()) +
+                "0000000000000006\r\nabcdef\r\n");
+        }
+
+        // stream
+        {
+            serializer::coalesce_options opt;
+            opt.min_size = 8;
+            sr.reset();
+            sr.coalesce_output(opt);
+            auto stream = sr.start_stream(res);
+            auto const write = [&](core::string_view t)
+            {
+                auto n = buffers::buffer_copy(
+                    stream.prepare(),
+                    buffers::const_buffer(t.data(), t.size()));
+                stream.commit(n);
+            };
+            auto const read_all = [&]
+            {
+                auto cbs = sr.prepare().value();
+                std::string s;
+                append(s, cbs);
+                sr.consume(buffers::buffer_size(cbs));
+                return s;
+            };
+
+            write("abc");
+            BOOST_TEST(sr.prepare().error() == error::need_data);
+            write("def");
+            BOOST_TEST(sr.prepare().error() == error::need_data);
+            sr.flush();
+            BOOST_TEST_EQ(read_all(),
+                std::string(res.buffer()) +
+                "0000000000000006\r\nabcdef\r\n");
+            write("ghijklmnop");
+            BOOST_TEST_EQ(read_all(),
+                "000000000000000A\r\nghijklmnop\r\n");
+            write("q");
+            stream.close();
+            BOOST_TEST_EQ(read_all(),
+                "0000000000000001\r\nq\r\n"
+                "0\r\n\r\n");
+            BOOST_TEST(sr.is_done());
+        }
+    }
+
+    void
+    testRecords()
+    {
+        context ctx;
+        serializer sr(ctx);
+        response res(
+            "HTTP/1.1 200 OK\r\n"
+            "Content-Length: 100\r\n"
+            "\r\n");
+        std::string const body(100, 'x');
+        auto const hs = res.buffer().size();
+
+        serializer::record_options opt;
+        opt.first_size = 64;
+        opt.size = 50;
+        sr.shape_records(opt);
+
+        auto const next = [&]
+        {
+            auto cbs = sr.prepare().value();
+            BOOST_TEST_EQ(
+                std::distance(cbs.begin(), cbs.end()), 1);
+            return *cbs.begin();
+        };
+
+        for(int i = 0; i < 2; ++i)
+        {
+            // kept across reset
+            sr.reset();
+            sr.start(res, buffers::const_buffer(
+                body.data(), body.size()));
+
+            // header and body merged
+            auto b = next();
+            BOOST_TEST_EQ(b.size(), 64u);
+            std::string s(
+                static_cast<char const*>(b.data()),
+                b.size());
+            BOOST_TEST_EQ(s,
+                std::string(res.buffer()) +
+                body.substr(0, 64 - hs));
+            sr.consume(b.size());
+
+            // a full record from the body
+            b = next();
+            BOOST_TEST_EQ(b.size(), 50u);
+            BOOST_TEST(b.data() ==
+                body.data() + 64 - hs);
+
+            // the rest of a partly consumed record
+            sr.consume(20);
+            b = next();
+            BOOST_TEST_EQ(b.size(), 30u);
+            sr.consume(30);
+
+            b = next();
+            BOOST_TEST_EQ(b.size(), 100 + hs - 114);
+            sr.consume(b.size());
+            BOOST_TEST(sr.is_done());
+        }
+
+        // disabled
+        opt.size = 0;
+        sr.shape_records(opt);
+        sr.reset();
+        sr.start(res, buffers::const_buffer(
+            body.data(), body.size()));
+        BOOST_TEST_EQ(
+            buffers::buffer_size(sr.prepare().value()),
+            hs + 100);
+
+        // no staging area for an empty
+        // body or a file region
+        {
+            serializer sr2(ctx, 1024);
+            opt.first_size = 0;
+            opt.size = 2048;
+            sr2.shape_records(opt);
+
+            response res2(
+                "HTTP/1.1 204 No Content\r\n"
+                "\r\n");
+            sr2.start(res2);
+            auto cbs = sr2.prepare().value();
+            BOOST_TEST_EQ(
+                buffers::buffer_size(cbs),
+                res2.buffer().size());
+            sr2.consume(buffers::buffer_size(cbs));
+            BOOST_TEST(sr2.is_done());
+
+            file_region r{};
+            r.size = 100;
+            sr2.reset();
+            sr2.start(res, r);
+            BOOST_TEST_EQ(
+                buffers::buffer_size(sr2.prepare().value()),
+                hs);
+        }
+    }
+
+    void
+    testMessageEnd()
+    {
+        context ctx;
+        serializer sr(ctx);
+
+        // empty body
+        {
+            response res(
+                "HTTP/1.1 204 No Content\r\n"
+                "\r\n");
+            sr.reset();
+            sr.start(res);
+            BOOST_TEST(! sr.is_message_end());
+            auto cbs = sr.prepare().value();
+            BOOST_TEST(sr.is_message_end());
+            BOOST_TEST(! sr.expects_more());
+            sr.consume(buffers::buffer_size(cbs));
+            BOOST_TEST(sr.is_done());
+        }
+
+        // stream
+        {
+            response res(
+                "HTTP/1.1 200 OK\r\n"
+                "Transfer-Encoding: chunked\r\n"
+                "\r\n");
+            sr.reset();
+            auto stream = sr.start_stream(res);
+            auto n = buffers::buffer_copy(
+                stream.prepare(),
+                buffers::const_buffer("abc", 3));
+            stream.commit(n);
+            auto cbs = sr.prepare().value();
+            BOOST_TEST(sr.expects_more());
+            sr.consume(buffers::buffer_size(cbs));
+            BOOST_TEST(sr.prepare().error() ==
+                error::need_data);
+            BOOST_TEST(sr.expects_more());
+            stream.close();
+            cbs = sr.prepare().value();
+            BOOST_TEST(sr.is_message_end());
+            sr.consume(buffers::buffer_size(cbs));
+            BOOST_TEST(sr.is_done());
+        }
+
+        // Expect: 100-continue
+        {
+            request req(
+                "POST / HTTP/1.1\r\n"
+                "Expect: 100-continue\r\n"
+                "Content-Length: 5\r\n"
+                "\r\n");
+            sr.reset();
+            sr.start<test_source>(req, "12345");
+            auto cbs = sr.prepare().value();
+            BOOST_TEST(sr.expects_more());
+            sr.consume(buffers::buffer_size(cbs));
+            BOOST_TEST(sr.prepare().error() ==
+                error::expect_100_continue);
+            cbs = sr.prepare().value();
+            BOOST_TEST(sr.is_message_end());
+            sr.consume(buffers::buffer_size(cbs));
+            BOOST_TEST(sr.is_done());
+        }
+
+        // shaped into records
+        {
+            response res(
+                "HTTP/1.1 200 OK\r\n"
+                "Content-Length: 100\r\n"
+                "\r\n");
+            std::string const body(100, 'x');
+            serializer::record_options opt;
+            opt.first_size = 64;
+            opt.size = 64;
+            sr.shape_records(opt);
+            sr.reset();
+            sr.start(res, buffers::const_buffer(
+                body.data(), body.size()));
+            auto cbs = sr.prepare().value();
+            BOOST_TEST(sr.expects_more());
+            sr.consume(buffers::buffer_size(cbs));
+            cbs = sr.prepare().value();
+            BOOST_TEST(sr.expects_more());
+            sr.consume(buffers::buffer_size(cbs));
+            cbs = sr.prepare().value();
+            BOOST_TEST(sr.is_message_end());
+            sr.consume(buffers::buffer_size(cbs));
+            BOOST_TEST(sr.is_done());
+            opt.size = 0;
+            sr.shape_records(opt);
+        }
+    }
+
+    void
+    testTrailer()
+    {
+        context ctx;
+        serializer sr(ctx);
+        std::string const hdr =
+            "HTTP/1.1 200 OK\r\n"
+            "Transfer-Encoding: chunked\r\n"
+            "\r\n";
+
+        fields trailer;
+        trailer.set("Grpc-Status", "0");
+        trailer.set("Grpc-Message", "ok");
+        std::string const end =
+            "0\r\n"
+            "Grpc-Status: 0\r\n"
+            "Grpc-Message: ok\r\n"
+            "\r\n";
+
+        // empty body
+        {
+            response res(hdr);
+            sr.reset();
+            sr.start(res);
+            sr.set_trailer(trailer);
+            BOOST_TEST_EQ(read(sr), hdr + end);
+        }
+
+        // buffers
+        {
+            response res(hdr);
+            sr.reset();
+            sr.start(res, buffers::const_buffer("abc", 3));
+            sr.set_trailer(trailer);
+            BOOST_TEST_EQ(read(sr), hdr +
+                "0000000000000003\r\nabc\r\n" + end);
+        }
+
+        // source
+        {
+            response res(hdr);
+            sr.reset();
+            sr.start<test_source>(res, "hello");
+            sr.set_trailer(trailer);
+            auto s = read(sr);
+            BOOST_TEST(s.size() > end.size());
+            BOOST_TEST_EQ(
+                s.substr(s.size() - end.size()), end);
+        }
+
+        // empty region
+        {
+            response res(hdr);
+            sr.reset();
+            sr.start(res, file_region{ {}, 0, 0 });
+            sr.set_trailer(trailer);
+            BOOST_TEST_EQ(read(sr), hdr + end);
+        }
+
+        // stream, with a digest of the body
+        {
+            response res(hdr);
+            sr.reset();
+            sr.compute_digest(digest_algorithm::sha256);
+            auto stream = sr.start_stream(res);
+            auto n = buffers::buffer_copy(
+                stream.prepare(),
+                buffers::const_buffer("abc", 3));
+            stream.commit(n);
+            std::string s = read_some(sr);
+
+            fields digest_trailer;
+            digest_trailer.set("Content-Digest",
+                sr.body_digest().to_field_value());
+            stream.close(digest_trailer);
+            BOOST_TEST_THROWS(
+                stream.close(digest_trailer),
+                std::logic_error);
+            s += read(sr);
+            BOOST_TEST_EQ(s, hdr +
+                "0000000000000003\r\nabc\r\n"
+                "0\r\n"
+                "Content-Digest: sha-256=:"
+                "ungWv48Bz+pBQUDeXa4iI7ADYaOWF3qctBD/YfIAFa0=:\r\n"
+                "\r\n");
+        }
+
+        // the start line of a message is not sent
+        {
+            response res(hdr);
+            response t;
+            t.set("Expires", "0");
+            sr.reset();
+            sr.start(res);
+            sr.set_trailer(t);
+            BOOST_TEST_EQ(read(sr), hdr +
+                "0\r\nExpires: 0\r\n\r\n");
+        }
+
+        // not started
+        sr.reset();
+        BOOST_TEST_THROWS(
+            sr.set_trailer(trailer),
+            std::logic_error);
+
+        // not chunked
+        {
+            response res;
+            res.set_content_length(3);
+            sr.reset();
+            sr.start(res, buffers::const_buffer("abc", 3));
+            BOOST_TEST_THROWS(
+                sr.set_trailer(trailer),
+                std::logic_error);
+        }
+
+        // the last chunk was already prepared
+        {
+            response res(hdr);
+            sr.reset();
+            sr.start(res, buffers::const_buffer("abc", 3));
+            auto cbs = sr.prepare().value();
+            BOOST_TEST_THROWS(
+                sr.set_trailer(trailer),
+                std::logic_error);
+            sr.consume(buffers::buffer_size(cbs));
+            BOOST_TEST(sr.is_done());
+        }
+    }
+
+    void
+    testSse()
+    {
+        context ctx;
+        response res(
+            "HTTP/1.1 200 OK\r\n"
+            "Content-Type: text/event-stream\r\n"
+            "Transfer-Encoding: chunked\r\n"
+            "\r\n");
+
+        // the body of each chunk
+        auto const read_chunk = [](
+            serializer& sr) -> std::string
+        {
+            auto s = read_some(sr);
+            auto const pos = s.find("\r\n");
+            BOOST_TEST(pos != std::string::npos);
+            return s.substr(pos + 2,
+                s.size() - pos - 4);
+        };
+
+        // each event is a chunk
+        {
+            serializer sr(ctx);
+            auto es = sr.start_sse(res);
+
+            // the header does not wait for an event
+            BOOST_TEST_EQ(read_some(sr), res.buffer());
+            BOOST_TEST(sr.prepare().error() ==
+                error::need_data);
+
+            serializer::sse_event ev;
+            ev.data = "hello";
+            BOOST_TEST(es.write(ev));
+            BOOST_TEST_EQ(read_chunk(sr),
+                "data: hello\n\n");
+
+            ev.data = "one\ntwo\r\nthree\rfour";
+            ev.event = "update";
+            ev.id = "42";
+            BOOST_TEST(es.write(ev));
+            BOOST_TEST_EQ(read_chunk(sr),
+                "event: update\n"
+                "id: 42\n"
+                "data: one\n"
+                "data: two\n"
+                "data: three\n"
+                "data: four\n"
+                "\n");
+
+            BOOST_TEST(es.ping());
+            BOOST_TEST_EQ(read_chunk(sr), ":\n\n");
+
+            ev = {};
+            ev.id = "1\n";
+            BOOST_TEST_THROWS(
+                es.write(ev),
+                std::invalid_argument);
+
+            es.close();
+            BOOST_TEST_EQ(read(sr), "0\r\n\r\n");
+            BOOST_TEST_THROWS(
+                es.write(ev),
+                std::logic_error);
+            BOOST_TEST_THROWS(
+                es.ping(),
+                std::logic_error);
+        }
+
+        // events are batched
+        {
+            serializer sr(ctx);
+            serializer::sse_options opt;
+            opt.max_latency = std::chrono::hours(1);
+            opt.batch_size = 32;
+            auto es = sr.start_sse(res, opt);
+            BOOST_TEST_EQ(read_some(sr), res.buffer());
+
+            serializer::sse_event ev;
+            ev.data = "a";
+            BOOST_TEST(es.write(ev));
+            BOOST_TEST(sr.prepare().error() ==
+                error::need_data);
+            ev.data = "b";
+            BOOST_TEST(es.write(ev));
+            BOOST_TEST(sr.prepare().error() ==
+                error::need_data);
+
+            // a ping is not held
+            BOOST_TEST(es.ping());
+            BOOST_TEST_EQ(read_chunk(sr),
+                "data: a\n\ndata: b\n\n:\n\n");
+
+            // enough for a batch
+            ev.data = "0123456789abcdef0123456789";
+            BOOST_TEST(es.write(ev));
+            BOOST_TEST_EQ(read_chunk(sr),
+                "data: 0123456789abcdef0123456789\n\n");
+
+            ev.data = "c";
+            BOOST_TEST(es.write(ev));
+            BOOST_TEST(sr.prepare().error() ==
+                error::need_data);
+            sr.flush();
+            BOOST_TEST_EQ(read_chunk(sr),
+                "data: c\n\n");
+        }
+
+        // the buffer is full
+        {
+            serializer sr(ctx, 512);
+            auto es = sr.start_sse(res);
+            read_some(sr);
+
+            std::string const big(600, 'x');
+            serializer::sse_event ev;
+            ev.data = big;
+            BOOST_TEST_THROWS(
+                es.write(ev),
+                std::length_error);
+
+            std::string const part(100, 'x');
+            ev.data = part;
+            std::size_t n = 0;
+            while(es.write(ev))
+                ++n;
+            BOOST_TEST(n > 0);
+            auto cbs = sr.prepare().value();
+            sr.consume(buffers::buffer_size(cbs));
+            BOOST_TEST(es.write(ev));
+        }
+    }
+
+    void
+    testSharedStream()
+    {
+        struct event
+        {
+            std::mutex m;
+            std::condition_variable cv;
+            bool set = false;
+
+            void
+            notify()
+            {
+                std::lock_guard<std::mutex> lock(m);
+                set = true;
+                cv.notify_one();
+            }
+
+            void
+            wait()
+            {
+                std::unique_lock<std::mutex> lock(m);
+                cv.wait(lock, [this]{ return set; });
+                set = false;
+            }
+        };
+
+        struct handler
+            : serializer::shared_stream::handler
+        {
+            event data;
+            event space;
+
+            void
+            on_data() noexcept override
+            {
+                data.notify();
+            }
+
+            void
+            on_space() noexcept override
+            {
+                space.notify();
+            }
+        };
+
+        std::string body(200000, 0);
+        for(std::size_t i = 0; i < body.size(); ++i)
+            body[i] = "0123456789abcdef"[(i * 7) % 16];
+
+        context ctx;
+        serializer sr(ctx, 4096);
+        response res;
+        res.set_content_length(body.size());
+        auto ss = sr.start_shared_stream(res);
+        handler h;
+        ss.set_handler(&h);
+
+        std::thread t([&]
+        {
+            core::string_view in = body;
+            while(! in.empty())
+            {
+                auto mbp = ss.prepare();
+                auto n = buffers::buffer_copy(
+                    mbp, buffers::const_buffer(
+                        in.data(), in.size()));
+                if(n == 0)
+                {
+                    h.space.wait();
+                    continue;
+                }
+                ss.commit(n);
+                in.remove_prefix(n);
+            }
+            ss.close();
+        });
+
+        std::string out;
+        while(! sr.is_done())
+        {
+            auto rv = sr.prepare();
+            if( rv.has_error() &&
+                rv.error() == error::would_block )
+            {
+                h.data.wait();
+                continue;
+            }
+            auto cbs = rv.value();
+            append(out, cbs);
+            sr.consume(buffers::buffer_size(cbs));
+        }
+        t.join();
+        BOOST_TEST(out ==
+            std::string(res.buffer()) + body);
+
+        // closed twice
+        sr.reset();
+        ss = sr.start_shared_stream(res);
+        ss.close();
+        BOOST_TEST_THROWS(ss.close(), std::logic_error);
+        BOOST_TEST_THROWS(ss.commit(0), std::logic_error);
+    }
+
     void
     run()
     {
@@ -824,6 +2057,16 @@ struct serializer_test
         testOutput();
         testExpect100Continue();
         testStreamErrors();
+        testFileRegion();
+        testRanges();
+        testViewSource();
+        testBatch();
+        testCoalesce();
+        testRecords();
+        testMessageEnd();
+        testTrailer();
+        testSse();
+        testSharedStream();
     }
 };
 
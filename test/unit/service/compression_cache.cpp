@@ -0,0 +1,156 @@
+//
+// Copyright (c) 2026 agent (agent@local)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/cppalliance/http_proto
+//
+
+// Test that header file is self-contained.
+#include <boost/http_proto/service/compression_cache.hpp>
+
+#include <boost/http_proto/context.hpp>
+
+#include "test_helpers.hpp"
+
+#include <memory>
+#include <stdexcept>
+#include <string>
+
+namespace boost {
+namespace http_proto {
+
+struct compression_cache_test
+{
+    static
+    buffers::const_buffer_span
+    span_of(
+        buffers::const_buffer const* p,
+        std::size_t n)
+    {
+        return buffers::const_buffer_span(p, n);
+    }
+
+    void
+    testFindInsert()
+    {
+        context ctx;
+        auto& cc = install_compression_cache(ctx, {});
+        BOOST_TEST_EQ(cc.count(), 0u);
+
+        std::string const body = "Hello, world!";
+        buffers::const_buffer b[] = {
+            { body.data(), 5 },
+            { body.data() + 5, body.size() - 5 } };
+        auto const bs = span_of(b, 2);
+
+        BOOST_TEST(! cc.find(bs, encoding::gzip, -1));
+
+        cc.insert(bs, encoding::gzip, -1, "gz");
+        BOOST_TEST_EQ(cc.count(), 1u);
+        BOOST_TEST_EQ(cc.size(), body.size() + 2);
+
+        // the split of the buffers does not matter
+        buffers::const_buffer b1(
+            body.data(), body.size());
+        auto v = cc.find(
+            span_of(&b1, 1), encoding::gzip, -1);
+        BOOST_TEST(v);
+        BOOST_TEST_EQ(*v, "gz");
+
+        // coding and level are part of the key
+        BOOST_TEST(! cc.find(bs, encoding::deflate, -1));
+        BOOST_TEST(! cc.find(bs, encoding::gzip, 9));
+
+        // different octets of the same size
+        std::string other = body;
+        other[0] = 'J';
+        buffers::const_buffer b2(
+            other.data(), other.size());
+        BOOST_TEST(! cc.find(
+            span_of(&b2, 1), encoding::gzip, -1));
+
+        // duplicate inserts are ignored
+        cc.insert(bs, encoding::gzip, -1, "other");
+        BOOST_TEST_EQ(cc.count(), 1u);
+        BOOST_TEST_EQ(*cc.find(bs, encoding::gzip, -1), "gz");
+
+        cc.clear();
+        BOOST_TEST_EQ(cc.count(), 0u);
+        BOOST_TEST_EQ(cc.size(), 0u);
+
+        // values outlive eviction
+        BOOST_TEST_EQ(*v, "gz");
+
+        // ownership of the value is taken
+        auto const owned =
+            std::make_shared<std::string const>("gz2");
+        cc.insert(bs, encoding::gzip, -1, owned);
+        BOOST_TEST(cc.find(
+            bs, encoding::gzip, -1) == owned);
+        BOOST_TEST_THROWS(
+            cc.insert(bs, encoding::deflate, -1,
+                compression_cache::value_type()),
+            std::invalid_argument);
+        cc.clear();
+
+        // service exists
+        BOOST_TEST_THROWS(
+            install_compression_cache(ctx, {}),
+            std::invalid_argument);
+    }
+
+    void
+    testEviction()
+    {
+        context ctx;
+        compression_cache::config cfg;
+        cfg.max_size = 30;
+        cfg.max_body_size = 8;
+        auto& cc = install_compression_cache(ctx, cfg);
+
+        std::string const s1 = "aaaaaaaa";
+        std::string const s2 = "bbbbbbbb";
+        std::string const s3 = "cccccccc";
+        buffers::const_buffer b1(s1.data(), s1.size());
+        buffers::const_buffer b2(s2.data(), s2.size());
+        buffers::const_buffer b3(s3.data(), s3.size());
+
+        cc.insert(span_of(&b1, 1), encoding::deflate, -1, "11");
+        cc.insert(span_of(&b2, 1), encoding::deflate, -1, "22");
+        BOOST_TEST_EQ(cc.count(), 2u);
+        BOOST_TEST_EQ(cc.size(), 20u);
+
+        // touch the first entry
+        BOOST_TEST(cc.find(span_of(&b1, 1), encoding::deflate, -1));
+
+        // evicts the least recently used
+        cc.insert(span_of(&b3, 1), encoding::deflate, -1, "33");
+        BOOST_TEST_EQ(cc.count(), 2u);
+        BOOST_TEST(cc.find(span_of(&b1, 1), encoding::deflate, -1));
+        BOOST_TEST(! cc.find(span_of(&b2, 1), encoding::deflate, -1));
+        BOOST_TEST(cc.find(span_of(&b3, 1), encoding::deflate, -1));
+
+        // bodies over the limit are not stored
+        std::string const big(9, 'x');
+        buffers::const_buffer b4(big.data(), big.size());
+        cc.insert(span_of(&b4, 1), encoding::deflate, -1, "4");
+        BOOST_TEST(! cc.find(span_of(&b4, 1), encoding::deflate, -1));
+        BOOST_TEST_EQ(cc.count(), 2u);
+    }
+
+    void
+    run()
+    {
+        testFindInsert();
+        testEviction();
+    }
+};
+
+TEST_SUITE(
+    compression_cache_test,
+    "boost.http_proto.compression_cache");
+
+} // http_proto
+} // boost
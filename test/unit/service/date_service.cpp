@@ -0,0 +1,160 @@
+//
+// Copyright (c) 2026 agent (agent@local)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/cppalliance/http_proto
+//
+
+// Test that header file is self-contained.
+#include <boost/http_proto/service/date_service.hpp>
+
+#include <boost/http_proto/context.hpp>
+#include <boost/http_proto/field.hpp>
+#include <boost/http_proto/response.hpp>
+
+#include "test_suite.hpp"
+
+#include <atomic>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace boost {
+namespace http_proto {
+
+struct date_service_test
+{
+    static
+    std::string
+    format(std::time_t t)
+    {
+        char buf[date_service::size];
+        date_service::format(t, buf);
+        return std::string(buf, sizeof(buf));
+    }
+
+    void
+    testFormat()
+    {
+        BOOST_TEST_EQ(format(0),
+            "Thu, 01 Jan 1970 00:00:00 GMT");
+        BOOST_TEST_EQ(format(784111777),
+            "Sun, 06 Nov 1994 08:49:37 GMT");
+        BOOST_TEST_EQ(format(951782400),
+            "Tue, 29 Feb 2000 00:00:00 GMT");
+        BOOST_TEST_EQ(format(1709251199),
+            "Thu, 29 Feb 2024 23:59:59 GMT");
+        BOOST_TEST_EQ(format(-1),
+            "Wed, 31 Dec 1969 23:59:59 GMT");
+    }
+
+    void
+    testCopy()
+    {
+        context ctx;
+        auto& ds = install_date_service(ctx);
+        BOOST_TEST_THROWS(
+            install_date_service(ctx),
+            std::invalid_argument);
+
+        char buf[date_service::size];
+        ds.copy(buf, 784111777);
+        BOOST_TEST_EQ(std::string(buf, sizeof(buf)),
+            "Sun, 06 Nov 1994 08:49:37 GMT");
+        ds.copy(buf, 784111778);
+        BOOST_TEST_EQ(std::string(buf, sizeof(buf)),
+            "Sun, 06 Nov 1994 08:49:38 GMT");
+
+        // an earlier time keeps the newer date
+        ds.copy(buf, 784111777);
+        BOOST_TEST_EQ(std::string(buf, sizeof(buf)),
+            "Sun, 06 Nov 1994 08:49:38 GMT");
+
+        // the current time
+        auto const t0 = std::time(nullptr);
+        ds.copy(buf);
+        auto const t1 = std::time(nullptr);
+        auto const s = std::string(buf, sizeof(buf));
+        BOOST_TEST(s == format(t0) || s == format(t1));
+    }
+
+    void
+    testThreads()
+    {
+        context ctx;
+        auto& ds = install_date_service(ctx);
+        std::time_t const t = 784111777;
+        auto const s0 = format(t);
+        auto const s1 = format(t + 1);
+
+        std::atomic<int> bad(0);
+        std::vector<std::thread> v;
+        for(int n = 0; n < 4; ++n)
+            v.emplace_back([&, n]
+            {
+                char buf[date_service::size];
+                for(int i = 0; i < 10000; ++i)
+                {
+                    ds.copy(buf, t + ((i + n) & 1));
+                    std::string s(buf, sizeof(buf));
+                    if(s != s0 && s != s1)
+                        ++bad;
+                }
+            });
+        for(auto& th : v)
+            th.join();
+        BOOST_TEST_EQ(bad.load(), 0);
+    }
+
+    void
+    testSetDateNow()
+    {
+        context ctx;
+        response res;
+        BOOST_TEST_THROWS(
+            res.set_date_now(ctx),
+            std::invalid_argument);
+
+        install_date_service(ctx);
+        res.set(field::server, "Boost");
+        res.set_date_now(ctx);
+        BOOST_TEST_EQ(res.count(field::date), 1u);
+        auto const s = res.value_or(field::date, "");
+        BOOST_TEST_EQ(s.size(), date_service::size);
+        BOOST_TEST(s.ends_with(" GMT"));
+
+        // in place
+        auto const n = res.buffer().size();
+        res.set_date_now(ctx);
+        BOOST_TEST_EQ(res.buffer().size(), n);
+        BOOST_TEST_EQ(res.count(field::date), 1u);
+
+        // replaced
+        res.set(field::date, "yesterday");
+        res.append(field::date, "today");
+        res.set_date_now(ctx);
+        BOOST_TEST_EQ(res.count(field::date), 1u);
+        BOOST_TEST_EQ(res.value_or(
+            field::date, "").size(), date_service::size);
+        BOOST_TEST_EQ(res.buffer().size(), n);
+    }
+
+    void
+    run()
+    {
+        testFormat();
+        testCopy();
+        testThreads();
+        testSetDateNow();
+    }
+};
+
+TEST_SUITE(
+    date_service_test,
+    "boost.http_proto.date_service");
+
+} // http_proto
+} // boost
@@ -0,0 +1,116 @@
+//
+// Copyright (c) 2026 agent (agent@local)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/cppalliance/http_proto
+//
+
+// Test that header file is self-contained.
+#include <boost/http_proto/service/uring_service.hpp>
+
+#if BOOST_HTTP_PROTO_USE_IO_URING
+
+#include <boost/system/system_error.hpp>
+
+#include "test_helpers.hpp"
+
+#include <cstdio>
+#include <stdexcept>
+#include <string>
+#include <fcntl.h>
+#include <unistd.h>
+
+namespace boost {
+namespace http_proto {
+
+struct uring_service_test
+{
+    struct op
+        : uring_service::operation
+    {
+        int res = 0;
+        int calls = 0;
+
+        void
+        on_complete(int res_) noexcept override
+        {
+            res = res_;
+            ++calls;
+        }
+    };
+
+    void
+    run()
+    {
+        context ctx;
+        uring_service* svc;
+        try
+        {
+            svc = &install_uring_service(ctx);
+        }
+        catch(system::system_error const&)
+        {
+            // io_uring is unavailable
+            return;
+        }
+        BOOST_TEST_EQ(
+            &ctx.get_service<uring_service>(), svc);
+        BOOST_TEST_THROWS(
+            install_uring_service(ctx),
+            std::invalid_argument);
+        BOOST_TEST_GE(svc->native_handle(), 0);
+        BOOST_TEST_EQ(svc->poll(), 0u);
+        BOOST_TEST_EQ(svc->run_one(), 0u);
+
+        std::string const path =
+            "uring_service_test.txt";
+        int fd = ::open(path.c_str(),
+            O_RDWR | O_CREAT | O_TRUNC, 0644);
+        BOOST_TEST_GE(fd, 0);
+
+        // write at an offset, then read it back
+        {
+            op w;
+            svc->write(fd, "world", 5, 6, w);
+            op w2;
+            svc->write(fd, "hello ", 6, 0, w2);
+            std::size_t n = 0;
+            while(n < 2)
+                n += svc->run_one();
+            BOOST_TEST_EQ(w.calls, 1);
+            BOOST_TEST_EQ(w.res, 5);
+            BOOST_TEST_EQ(w2.res, 6);
+
+            char buf[16] = {};
+            op r;
+            svc->read(fd, buf, sizeof(buf), 0, r);
+            BOOST_TEST_EQ(svc->run_one(), 1u);
+            BOOST_TEST_EQ(r.res, 11);
+            BOOST_TEST_EQ(
+                std::string(buf), "hello world");
+        }
+
+        // errors are negated errno values
+        {
+            op r;
+            char buf[1];
+            svc->read(-1, buf, 1, 0, r);
+            svc->run_one();
+            BOOST_TEST_LT(r.res, 0);
+        }
+
+        ::close(fd);
+        std::remove(path.c_str());
+    }
+};
+
+TEST_SUITE(
+    uring_service_test,
+    "boost.http_proto.uring_service");
+
+} // http_proto
+} // boost
+
+#endif
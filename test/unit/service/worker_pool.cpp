@@ -0,0 +1,93 @@
+//
+// Copyright (c) 2026 agent (agent@local)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/cppalliance/http_proto
+//
+
+// Test that header file is self-contained.
+#include <boost/http_proto/service/worker_pool.hpp>
+
+#include <boost/http_proto/context.hpp>
+
+#include "test_helpers.hpp"
+
+#include <atomic>
+#include <stdexcept>
+#include <vector>
+
+namespace boost {
+namespace http_proto {
+
+struct worker_pool_test
+{
+    struct counter
+        : worker_pool::work
+    {
+        std::atomic<std::size_t>& n;
+
+        explicit
+        counter(std::atomic<std::size_t>& n_)
+            : n(n_)
+        {
+        }
+
+        void
+        run() noexcept override
+        {
+            ++n;
+        }
+    };
+
+    void
+    testInstall()
+    {
+        context ctx;
+        BOOST_TEST(! ctx.find_service<worker_pool>());
+        auto& wp = install_worker_pool(ctx, 2);
+        BOOST_TEST_EQ(wp.concurrency(), 2u);
+        BOOST_TEST_EQ(
+            ctx.find_service<worker_pool>(), &wp);
+        BOOST_TEST_THROWS(
+            install_worker_pool(ctx, 2),
+            std::invalid_argument);
+
+        // zero means the number of hardware threads
+        context ctx2;
+        BOOST_TEST_GT(
+            install_worker_pool(ctx2).concurrency(), 0u);
+    }
+
+    void
+    testPost()
+    {
+        std::atomic<std::size_t> n{ 0 };
+        std::vector<counter> v(100, counter(n));
+        {
+            context ctx;
+            auto& wp = install_worker_pool(ctx, 4);
+            for(auto& w : v)
+                wp.post(w);
+
+            // pending work runs before
+            // the context is destroyed
+        }
+        BOOST_TEST_EQ(n.load(), v.size());
+    }
+
+    void
+    run()
+    {
+        testInstall();
+        testPost();
+    }
+};
+
+TEST_SUITE(
+    worker_pool_test,
+    "boost.http_proto.worker_pool");
+
+} // http_proto
+} // boost
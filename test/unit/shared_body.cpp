@@ -0,0 +1,131 @@
+//
+// Copyright (c) 2026 agent (agent@local)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/cppalliance/http_proto
+//
+
+// Test that header file is self-contained.
+#include <boost/http_proto/shared_body.hpp>
+
+#include <boost/http_proto/response.hpp>
+#include <boost/http_proto/serializer.hpp>
+#include <boost/buffers/buffer_size.hpp>
+
+#include "test_helpers.hpp"
+
+#include <atomic>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace boost {
+namespace http_proto {
+
+struct shared_body_test
+{
+    void
+    testBody()
+    {
+        std::string const s(200000, 'x');
+        shared_body body(s);
+        BOOST_TEST_EQ(body.use_count(), 1);
+        BOOST_TEST_EQ(body.buffer().size(), s.size());
+
+        std::weak_ptr<void const> wp;
+        {
+            auto p = std::make_shared<
+                std::string const>(s);
+            wp = p;
+            body = shared_body(std::move(p));
+        }
+        auto const data = body.buffer().data();
+
+        response res;
+        res.set_content_length(s.size());
+
+        context ctx;
+        serializer sr0(ctx);
+        serializer sr1(ctx);
+        sr0.start(res, body);
+        sr1.start(res, body);
+        BOOST_TEST_EQ(body.use_count(), 3);
+
+        // not copied
+        auto cbs = sr0.prepare().value();
+        BOOST_TEST_EQ(
+            buffers::buffer_size(cbs),
+            res.buffer().size() + s.size());
+        auto it = cbs.begin();
+        ++it;
+        BOOST_TEST(it->data() == data);
+
+        auto const expected =
+            std::string(res.buffer()) + s;
+        BOOST_TEST(test_serialize(sr0) == expected);
+        BOOST_TEST(test_serialize(sr1) == expected);
+
+        // freed by the last reference
+        body = shared_body();
+        BOOST_TEST_EQ(body.buffer().size(), 0u);
+        BOOST_TEST(! wp.expired());
+        sr0.reset();
+        BOOST_TEST(! wp.expired());
+        sr1.reset();
+        BOOST_TEST(wp.expired());
+    }
+
+    void
+    testOwner()
+    {
+        auto v = std::make_shared<
+            std::vector<char>>(1000, 'y');
+        shared_body body(v, buffers::const_buffer(
+            v->data(), v->size()));
+        BOOST_TEST_EQ(v.use_count(), 2);
+        v.reset();
+
+        response res;
+        res.set_content_length(1000);
+        auto const expected =
+            std::string(res.buffer()) +
+            std::string(1000, 'y');
+
+        // sent from several threads at once
+        std::atomic<int> bad(0);
+        std::vector<std::thread> threads;
+        for(int i = 0; i < 4; ++i)
+            threads.emplace_back([&, body]
+            {
+                context ctx;
+                serializer sr(ctx);
+                for(int j = 0; j < 100; ++j)
+                {
+                    sr.reset();
+                    sr.start(res, body);
+                    if(test_serialize(sr) != expected)
+                        ++bad;
+                }
+            });
+        for(auto& t : threads)
+            t.join();
+        BOOST_TEST_EQ(bad.load(), 0);
+        BOOST_TEST_EQ(body.use_count(), 1);
+    }
+
+    void
+    run()
+    {
+        testBody();
+        testOwner();
+    }
+};
+
+TEST_SUITE(
+    shared_body_test,
+    "boost.http_proto.shared_body");
+
+} // http_proto
+} // boost
@@ -114,10 +114,45 @@ struct sink_test
         }
     }
 
+    void
+    testSizeHint()
+    {
+        struct hint_sink : test_sink
+        {
+            std::uint64_t hint = 0;
+
+            hint_sink() noexcept
+                : test_sink(99)
+            {
+            }
+
+            void
+            on_size_hint(
+                std::uint64_t n) noexcept override
+            {
+                hint = n;
+            }
+        };
+
+        // default does nothing
+        {
+            test_sink dest(99);
+            dest.size_hint(100);
+            BOOST_TEST(dest.str().empty());
+        }
+
+        {
+            hint_sink dest;
+            dest.size_hint(100);
+            BOOST_TEST_EQ(dest.hint, 100u);
+        }
+    }
+
     void
     run()
     {
         testSink();
+        testSizeHint();
     }
 };
 
@@ -13,6 +13,7 @@
 #include <boost/http_proto/fields.hpp>
 #include <boost/http_proto/request.hpp>
 #include <boost/http_proto/response.hpp>
+#include <boost/http_proto/serializer.hpp>
 #include <boost/buffers/buffer_copy.hpp>
 #include <boost/buffers/buffer_size.hpp>
 #include <boost/buffers/make_buffer.hpp>
@@ -36,6 +37,18 @@ test_pattern()
     return pat;
 }
 
+// Return n bytes of a repeating pattern,
+// for the contents of a file or a body
+inline
+std::string
+test_contents(std::size_t n)
+{
+    std::string s(n, 0);
+    for(std::size_t i = 0; i < n; ++i)
+        s[i] = "0123456789abcdef"[(i * 7) % 16];
+    return s;
+}
+
 template<class Buffers>
 std::string
 test_to_string(Buffers const& bs)
@@ -48,6 +61,22 @@ test_to_string(Buffers const& bs)
     return s;
 }
 
+// Return the output of the serializer
+// until the message is complete
+inline
+std::string
+test_serialize(serializer& sr)
+{
+    std::string s;
+    while(! sr.is_done())
+    {
+        auto const cbs = sr.prepare().value();
+        s += test_to_string(cbs);
+        sr.consume(buffers::buffer_size(cbs));
+    }
+    return s;
+}
+
 //------------------------------------------------
 
 // Test that fields equals HTTP string
@@ -0,0 +1,250 @@
+//
+// Copyright (c) 2026 agent (agent@local)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/cppalliance/http_proto
+//
+
+// Test that header file is self-contained.
+#include <boost/http_proto/uring_body.hpp>
+
+#if BOOST_HTTP_PROTO_USE_IO_URING
+
+#include <boost/http_proto/request_parser.hpp>
+#include <boost/http_proto/response.hpp>
+#include <boost/http_proto/serializer.hpp>
+#include <boost/buffers/buffer_copy.hpp>
+#include <boost/buffers/buffer_size.hpp>
+#include <boost/buffers/make_buffer.hpp>
+#include <boost/system/system_error.hpp>
+
+#include "test_helpers.hpp"
+
+#include <algorithm>
+#include <cstdio>
+#include <string>
+
+namespace boost {
+namespace http_proto {
+
+struct uring_body_test
+{
+    context ctx_;
+    uring_service* svc_ = nullptr;
+    std::string const path_ =
+        "uring_body_test.txt";
+
+    file_uring
+    open(file_mode mode)
+    {
+        system::error_code ec;
+        file_uring f(ctx_);
+        f.open(path_.c_str(), mode, ec);
+        BOOST_TEST(! ec.failed());
+        return f;
+    }
+
+    std::string
+    read_file()
+    {
+        system::error_code ec;
+        auto f = open(file_mode::scan);
+        std::string s(
+            static_cast<std::size_t>(
+                f.size(ec)), 0);
+        if(! s.empty())
+            f.read(&s[0], s.size(), ec);
+        BOOST_TEST(! ec.failed());
+        return s;
+    }
+
+    void
+    testSource()
+    {
+        auto const contents =
+            test_contents(100000);
+        {
+            auto f = open(file_mode::write);
+            system::error_code ec;
+            f.write(contents.data(), contents.size(), ec);
+            BOOST_TEST(! ec.failed());
+        }
+
+        serializer sr(ctx_);
+        for(bool chunked : { false, true })
+        {
+            response res;
+            if(chunked)
+                res.set_chunked(true);
+            else
+                res.set_content_length(contents.size());
+            sr.reset();
+            auto& body = sr.start<uring_body>(
+                res, open(file_mode::scan),
+                std::uint64_t(-1), 4096);
+
+            std::string out;
+            std::size_t blocked = 0;
+            while(! sr.is_done())
+            {
+                auto rv = sr.prepare();
+                if( rv.has_error() &&
+                    rv.error() == error::would_block)
+                {
+                    BOOST_TEST(body.is_pending());
+                    ++blocked;
+                    svc_->run_one();
+                    continue;
+                }
+                auto cbs = rv.value();
+                auto const n =
+                    buffers::buffer_size(cbs);
+                std::string s(n, 0);
+                buffers::buffer_copy(
+                    buffers::make_buffer(&s[0], n), cbs);
+                out += s;
+                sr.consume(n);
+            }
+            BOOST_TEST_GT(blocked, 0u);
+
+            core::string_view sv = out;
+            auto pos = sv.find("\r\n\r\n");
+            if(! BOOST_TEST_NE(
+                pos, core::string_view::npos))
+                continue;
+            sv.remove_prefix(pos + 4);
+            if(! chunked)
+            {
+                BOOST_TEST(sv == contents);
+                continue;
+            }
+
+            // remove the chunked framing
+            std::string body_out;
+            while(! sv.empty())
+            {
+                auto eol = sv.find("\r\n");
+                auto const len = std::stoul(
+                    std::string(sv.substr(0, eol)),
+                    nullptr, 16);
+                sv.remove_prefix(eol + 2);
+                body_out.append(sv.data(), len);
+                sv.remove_prefix(len + 2);
+            }
+            BOOST_TEST(body_out == contents);
+        }
+    }
+
+    void
+    testSink()
+    {
+        auto const contents =
+            test_contents(50000);
+
+        for(bool chunked : { false, true })
+        {
+            std::string msg =
+                "POST / HTTP/1.1\r\n";
+            if(chunked)
+            {
+                msg += "Transfer-Encoding: chunked\r\n\r\n";
+                for(std::size_t i = 0;
+                    i < contents.size(); i += 10000)
+                {
+                    msg += "2710\r\n";
+                    msg += contents.substr(i, 10000);
+                    msg += "\r\n";
+                }
+                msg += "0\r\n\r\n";
+            }
+            else
+            {
+                msg += "Content-Length: " +
+                    std::to_string(contents.size()) +
+                    "\r\n\r\n";
+                msg += contents;
+            }
+
+            request_parser pr(ctx_);
+            pr.reset();
+            pr.start();
+            core::string_view in = msg;
+            std::size_t blocked = 0;
+            bool attached = false;
+            for(;;)
+            {
+                system::error_code ec;
+                pr.parse(ec);
+                if(ec == error::would_block)
+                {
+                    ++blocked;
+                    svc_->run_one();
+                    continue;
+                }
+                if(! attached && pr.got_header())
+                {
+                    pr.set_body<uring_body>(
+                        open(file_mode::write),
+                        std::uint64_t(-1), 4096);
+                    attached = true;
+                    continue;
+                }
+                if(ec == condition::need_more_input)
+                {
+                    if(! BOOST_TEST(! in.empty()))
+                        break;
+                    auto const n =
+                        buffers::buffer_copy(
+                            pr.prepare(),
+                            buffers::make_buffer(
+                                in.data(),
+                                (std::min)(
+                                    in.size(),
+                                    std::size_t(3000))));
+                    pr.commit(n);
+                    in.remove_prefix(n);
+                    continue;
+                }
+                if(! BOOST_TEST(! ec.failed()))
+                    break;
+                if(pr.is_complete())
+                    break;
+            }
+            BOOST_TEST(pr.is_complete());
+            BOOST_TEST_GT(blocked, 0u);
+            BOOST_TEST(read_file() == contents);
+        }
+    }
+
+    void
+    run()
+    {
+        try
+        {
+            svc_ = &install_uring_service(ctx_);
+        }
+        catch(system::system_error const&)
+        {
+            // io_uring is unavailable
+            return;
+        }
+        request_parser::config cfg;
+        cfg.body_limit = 1024 * 1024;
+        install_parser_service(ctx_, cfg);
+
+        testSource();
+        testSink();
+        std::remove(path_.c_str());
+    }
+};
+
+TEST_SUITE(
+    uring_body_test,
+    "boost.http_proto.uring_body");
+
+} // http_proto
+} // boost
+
+#endif
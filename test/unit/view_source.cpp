@@ -0,0 +1,96 @@
+//
+// Copyright (c) 2026 agent (agent@local)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Official repository: https://github.com/cppalliance/http_proto
+//
+
+// Test that header file is self-contained.
+#include <boost/http_proto/view_source.hpp>
+
+#include <boost/http_proto/source.hpp>
+#include <boost/static_assert.hpp>
+
+#include "test_helpers.hpp"
+
+namespace boost {
+namespace http_proto {
+
+struct view_source_test
+{
+    struct test_source : view_source
+    {
+        buffers::const_buffer cb_;
+        std::size_t released_ = 0;
+
+        test_source() noexcept
+        {
+            auto const& pat = test_pattern();
+            cb_ = { &pat[0], pat.size() };
+        }
+
+        results
+        on_prepare() override
+        {
+            results rv;
+            rv.data = cb_;
+            rv.finished = true;
+            return rv;
+        }
+
+        void
+        on_consume(std::size_t n) noexcept override
+        {
+            cb_ += n;
+            released_ += n;
+        }
+    };
+
+    void
+    testViewSource()
+    {
+        auto const& pat = test_pattern();
+
+        test_source ts;
+        view_source& vs = ts;
+        auto rs = vs.prepare();
+        BOOST_TEST(! rs.ec.failed());
+        BOOST_TEST(rs.finished);
+        BOOST_TEST_EQ(rs.data.size(), pat.size());
+        BOOST_TEST_EQ(
+            rs.data.data(), &pat[0]);
+
+        vs.consume(3);
+        BOOST_TEST_EQ(ts.released_, 3u);
+        rs = vs.prepare();
+        BOOST_TEST_EQ(
+            rs.data.size(), pat.size() - 3);
+    }
+
+    void
+    testIsViewSource()
+    {
+        BOOST_STATIC_ASSERT(
+            is_view_source<test_source>::value);
+        BOOST_STATIC_ASSERT(
+            ! is_view_source<source>::value);
+        BOOST_STATIC_ASSERT(
+            ! is_view_source<int>::value);
+    }
+
+    void
+    run()
+    {
+        testViewSource();
+        testIsViewSource();
+    }
+};
+
+TEST_SUITE(
+    view_source_test,
+    "boost.http_proto.view_source");
+
+} // http_proto
+} // boost
@@ -30,12 +30,15 @@ TEST_SUITE(
 
 #else
 
+#include <boost/http_proto/async_source.hpp>
 #include <boost/http_proto/context.hpp>
 #include <boost/http_proto/error.hpp>
 #include <boost/http_proto/request_parser.hpp>
 #include <boost/http_proto/response_parser.hpp>
 #include <boost/http_proto/response.hpp>
 #include <boost/http_proto/serializer.hpp>
+#include <boost/http_proto/service/compression_cache.hpp>
+#include <boost/http_proto/service/worker_pool.hpp>
 #include <boost/http_proto/service/zlib_service.hpp>
 
 #include <boost/buffers/algorithm.hpp>
@@ -48,9 +51,14 @@ TEST_SUITE(
 #include <boost/core/detail/string_view.hpp>
 #include <boost/core/span.hpp>
 
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
 #include <string>
 #include <vector>
 #include <random>
+#include <stdexcept>
 
 #include <zlib.h>
 
@@ -72,6 +80,24 @@ generate_book(std::size_t size)
     return out;
 };
 
+// bitwise CRC-32C, as a reference
+std::string
+crc32c_hex(boost::core::string_view s)
+{
+    std::uint32_t crc = 0xffffffff;
+    for(unsigned char c : s)
+    {
+        crc ^= c;
+        for(int k = 0; k < 8; ++k)
+            crc = (crc >> 1) ^ (0x82f63b78 & (0 - (crc & 1)));
+    }
+    crc = ~crc;
+    char buf[9];
+    std::snprintf(buf, sizeof(buf), "%08x",
+        static_cast<unsigned>(crc));
+    return buf;
+}
+
 namespace boost {
 namespace http_proto {
 
@@ -427,6 +453,7 @@ struct zlib_test
 
                 header += "\r\n";
             }
+            sr.compute_digest(digest_algorithm::crc32c);
 
             core::string_view str = header;
             std::vector<unsigned char> output(
@@ -494,6 +521,14 @@ struct zlib_test
             // BOOST_TEST_LT(compressed.size(), body.size());
 
             verify_compressed(compressed, body);
+
+            // the digest is of the encoded content
+            BOOST_TEST_EQ(
+                sr.body_digest().to_hex(),
+                crc32c_hex(core::string_view(
+                    reinterpret_cast<char const*>(
+                        compressed.data()),
+                    compressed.size())));
         }
     }
 
@@ -742,6 +777,7 @@ struct zlib_test
 
             pr.start();
             pr.set_body_limit(body_size);
+            pr.compute_digest(digest_algorithm::crc32c);
 
             auto rs = receiver(
                 pr,
@@ -750,11 +786,789 @@ struct zlib_test
 
             BOOST_TEST(rs == body);
 
+            // the digest is of the encoded content
+            BOOST_TEST_EQ(
+                pr.body_digest().to_hex(),
+                crc32c_hex(deflated_body));
+
             if(transfer == "to_eof")
                 pr.reset();
         }
     }
 
+    void
+    test_serializer_known_length()
+    {
+        std::string const body =
+            generate_book(100000);
+
+        bool const use_gzip[] = { false, true };
+        bool const use_storage[] = { false, true };
+
+        for( auto gzip : use_gzip )
+        for( auto storage : use_storage )
+        {
+            context ctx;
+            zlib::install_service(ctx);
+            std::size_t const space_needed =
+                ctx.get_service<zlib::service>()
+                    .deflator_space_needed(15, 8);
+            serializer sr(
+                ctx, space_needed + body.size());
+
+            response res;
+            res.set(
+                field::content_encoding,
+                gzip ? "gzip" : "deflate");
+
+            if( gzip )
+                sr.use_gzip_encoding();
+            else
+                sr.use_deflate_encoding();
+
+            std::vector<unsigned char> dest(body.size());
+            if( storage )
+                sr.start_compressed(
+                    res,
+                    buffers::const_buffer(
+                        body.data(), body.size()),
+                    buffers::mutable_buffer(
+                        dest.data(), dest.size()));
+            else
+                sr.start_compressed(
+                    res,
+                    buffers::const_buffer(
+                        body.data(), body.size()));
+
+            BOOST_TEST(! res.chunked());
+            BOOST_TEST_EQ(
+                res.payload(), payload::size);
+
+            auto const n = res.payload_size();
+            BOOST_TEST_GT(n, 0u);
+            BOOST_TEST_LT(n, body.size());
+
+            std::string out;
+            while(! sr.is_done() )
+            {
+                auto cbs = sr.prepare();
+                BOOST_TEST(cbs.has_value());
+                auto const m =
+                    buffers::buffer_size(*cbs);
+                std::string s(m, 0);
+                buffers::buffer_copy(
+                    buffers::mutable_buffer(
+                        &s[0], s.size()), *cbs);
+                out += s;
+                sr.consume(m);
+            }
+
+            core::string_view sv = out;
+            BOOST_TEST(sv.starts_with(res.buffer()));
+            sv.remove_prefix(res.buffer().size());
+            BOOST_TEST_EQ(sv.size(), n);
+
+            std::vector<unsigned char> compressed(
+                sv.begin(), sv.end());
+            verify_compressed(compressed, body);
+        }
+
+        // empty body
+        {
+            context ctx;
+            zlib::install_service(ctx);
+            serializer sr(
+                ctx,
+                ctx.get_service<zlib::service>()
+                    .deflator_space_needed(15, 8) + 1024);
+
+            response res;
+            sr.use_gzip_encoding();
+            sr.start_compressed(
+                res, buffers::const_buffer());
+            BOOST_TEST_GT(res.payload_size(), 0u);
+        }
+
+        // chunked messages are rejected
+        {
+            context ctx;
+            zlib::install_service(ctx);
+            serializer sr(
+                ctx,
+                ctx.get_service<zlib::service>()
+                    .deflator_space_needed(15, 8) + 1024);
+
+            response res;
+            res.set_chunked(true);
+            sr.use_gzip_encoding();
+            BOOST_TEST_THROWS(
+                sr.start_compressed(
+                    res,
+                    buffers::const_buffer(
+                        body.data(), body.size())),
+                std::logic_error);
+        }
+
+        // an encoding is required
+        {
+            context ctx;
+            serializer sr(ctx);
+
+            response res;
+            BOOST_TEST_THROWS(
+                sr.start_compressed(
+                    res,
+                    buffers::const_buffer(
+                        body.data(), body.size())),
+                std::logic_error);
+        }
+
+        // output does not fit
+        {
+            context ctx;
+            zlib::install_service(ctx);
+            serializer sr(
+                ctx,
+                ctx.get_service<zlib::service>()
+                    .deflator_space_needed(15, 8) + 1024);
+
+            response res;
+            sr.use_deflate_encoding();
+            char tiny[8];
+            BOOST_TEST_THROWS(
+                sr.start_compressed(
+                    res,
+                    buffers::const_buffer(
+                        body.data(), body.size()),
+                    buffers::mutable_buffer(
+                        tiny, sizeof(tiny))),
+                std::length_error);
+        }
+    }
+
+    void
+    test_serializer_cache()
+    {
+        std::string const body =
+            generate_book(20000);
+
+        context ctx;
+        zlib::install_service(ctx);
+        auto& cc = install_compression_cache(ctx, {});
+        serializer sr(
+            ctx,
+            ctx.get_service<zlib::service>()
+                .deflator_space_needed(15, 8) + (2 * 1024));
+
+        auto const serialize = [&](bool chunked)
+        {
+            sr.reset();
+            response res;
+            res.set(field::content_encoding, "gzip");
+            res.set_chunked(chunked);
+            sr.use_gzip_encoding();
+            sr.start(
+                res,
+                buffers::const_buffer(
+                    body.data(), body.size()));
+
+            std::string out;
+            while(! sr.is_done() )
+            {
+                auto cbs = sr.prepare();
+                if(! BOOST_TEST(cbs.has_value()) )
+                    break;
+                auto const m =
+                    buffers::buffer_size(*cbs);
+                std::string s(m, 0);
+                buffers::buffer_copy(
+                    buffers::mutable_buffer(
+                        &s[0], s.size()), *cbs);
+                out += s;
+                sr.consume(m);
+            }
+            return out;
+        };
+
+        // miss, output is stored
+        auto const s1 = serialize(false);
+        BOOST_TEST_EQ(cc.count(), 1u);
+
+        // hit, identical output
+        auto const s2 = serialize(false);
+        BOOST_TEST_EQ(cc.count(), 1u);
+        BOOST_TEST_EQ(s1, s2);
+
+        core::string_view sv = s2;
+        auto pos = sv.find("\r\n\r\n");
+        BOOST_TEST_NE(pos, core::string_view::npos);
+        sv.remove_prefix(pos + 4);
+        std::vector<unsigned char> compressed(
+            sv.begin(), sv.end());
+        verify_compressed(compressed, body);
+
+        // hit with chunked framing
+        auto const s3 = serialize(true);
+        BOOST_TEST_EQ(cc.count(), 1u);
+        BOOST_TEST(core::string_view(s3).ends_with(
+            "\r\n0\r\n\r\n"));
+
+        // known-length bodies share the entry
+        {
+            sr.reset();
+            response res;
+            sr.use_gzip_encoding();
+            sr.start_compressed(
+                res,
+                buffers::const_buffer(
+                    body.data(), body.size()));
+            BOOST_TEST_EQ(cc.count(), 1u);
+            BOOST_TEST_EQ(
+                res.payload_size(), sv.size());
+        }
+    }
+
+    void
+    test_serializer_parallel()
+    {
+        std::string const body =
+            generate_book(300000);
+
+        struct source_t : source
+        {
+            core::string_view body_;
+
+            explicit
+            source_t(core::string_view body)
+                : body_(body)
+            {
+            }
+
+            results
+            on_read(buffers::mutable_buffer b) override
+            {
+                results rs;
+                rs.bytes = buffers::buffer_copy(
+                    b,
+                    buffers::const_buffer(
+                        body_.data(),
+                        std::min(
+                            std::size_t{ 4096 },
+                            body_.size())));
+                body_.remove_prefix(rs.bytes);
+                rs.finished = body_.empty();
+                return rs;
+            }
+        };
+
+        auto const serialize = [&](
+            serializer& sr,
+            bool gzip,
+            bool use_source,
+            bool chunked)
+        {
+            serializer::parallel_options opt;
+            opt.block_size = 16 * 1024;
+
+            sr.reset();
+            response res;
+            res.set_chunked(chunked);
+            if(gzip)
+                sr.use_gzip_encoding(opt);
+            else
+                sr.use_deflate_encoding(opt);
+            if(use_source)
+                sr.start<source_t>(res, body);
+            else
+                sr.start(
+                    res,
+                    buffers::const_buffer(
+                        body.data(), body.size()));
+
+            std::string out;
+            while(! sr.is_done() )
+            {
+                auto cbs = sr.prepare();
+                if(! BOOST_TEST(cbs.has_value()) )
+                    break;
+                auto const m =
+                    buffers::buffer_size(*cbs);
+                BOOST_TEST_GT(m, 0u);
+                std::string s(m, 0);
+                buffers::buffer_copy(
+                    buffers::mutable_buffer(
+                        &s[0], s.size()), *cbs);
+                out += s;
+                sr.consume(m);
+            }
+            return out;
+        };
+
+        auto const check = [&](context& ctx)
+        {
+            serializer sr(ctx);
+            for(bool gzip : { true, false })
+            for(bool use_source : { true, false })
+            {
+                auto const s = serialize(
+                    sr, gzip, use_source, false);
+                core::string_view sv = s;
+                auto pos = sv.find("\r\n\r\n");
+                if(! BOOST_TEST_NE(
+                    pos, core::string_view::npos))
+                    continue;
+                sv.remove_prefix(pos + 4);
+                std::vector<unsigned char> compressed(
+                    sv.begin(), sv.end());
+                verify_compressed(compressed, body);
+
+                // no empty chunk before the last one
+                auto const s2 = serialize(
+                    sr, gzip, use_source, true);
+                BOOST_TEST(core::string_view(s2).ends_with(
+                    "\r\n0\r\n\r\n"));
+                BOOST_TEST_EQ(
+                    core::string_view(s2).find(
+                        "0000000000000000\r\n"),
+                    core::string_view::npos);
+            }
+        };
+
+        // on the calling thread
+        {
+            context ctx;
+            zlib::install_service(ctx);
+            check(ctx);
+        }
+
+        // on a worker pool
+        {
+            context ctx;
+            zlib::install_service(ctx);
+            install_worker_pool(ctx, 3);
+            check(ctx);
+        }
+    }
+
+    void
+    test_serializer_skip_incompressible()
+    {
+        std::string const text =
+            generate_book(50000);
+        std::string noise(50000, 0);
+        {
+            std::mt19937 rng(1);
+            for(auto& c : noise)
+                c = static_cast<char>(rng());
+        }
+
+        struct source_t : source
+        {
+            core::string_view body_;
+
+            explicit
+            source_t(core::string_view body)
+                : body_(body)
+            {
+            }
+
+            results
+            on_read(buffers::mutable_buffer b) override
+            {
+                results rs;
+                rs.bytes = buffers::buffer_copy(
+                    b,
+                    buffers::const_buffer(
+                        body_.data(),
+                        std::min(
+                            std::size_t{ 1000 },
+                            body_.size())));
+                body_.remove_prefix(rs.bytes);
+                rs.finished = body_.empty();
+                return rs;
+            }
+        };
+
+        context ctx;
+        zlib::install_service(ctx);
+        serializer sr(
+            ctx,
+            ctx.get_service<zlib::service>()
+                .deflator_space_needed(15, 8) + 65536);
+
+        auto const read_all = [&]()
+        {
+            std::string out;
+            while(! sr.is_done() )
+            {
+                auto cbs = sr.prepare();
+                if(! BOOST_TEST(cbs.has_value()) )
+                    break;
+                auto const m =
+                    buffers::buffer_size(*cbs);
+                std::string s(m, 0);
+                buffers::buffer_copy(
+                    buffers::mutable_buffer(
+                        &s[0], s.size()), *cbs);
+                out += s;
+                sr.consume(m);
+            }
+            return out;
+        };
+
+        auto const serialize = [&](
+            core::string_view body,
+            bool use_source)
+        {
+            sr.reset();
+            response res;
+            res.set(field::content_encoding, "gzip");
+            sr.use_gzip_encoding();
+            sr.skip_incompressible();
+            if(use_source)
+                sr.start<source_t>(res, body);
+            else
+                sr.start(
+                    res,
+                    buffers::const_buffer(
+                        body.data(), body.size()));
+            return read_all();
+        };
+
+        auto const split = [](
+            core::string_view s,
+            core::string_view& body)
+        {
+            auto pos = s.find("\r\n\r\n");
+            BOOST_TEST_NE(pos, core::string_view::npos);
+            body = s.substr(pos + 4);
+            return s.substr(0, pos + 4);
+        };
+
+        for(bool use_source : { false, true })
+        {
+            // noise is sent as-is
+            {
+                auto const s = serialize(noise, use_source);
+                core::string_view body;
+                auto const h = split(s, body);
+                BOOST_TEST_EQ(
+                    h.find("Content-Encoding"),
+                    core::string_view::npos);
+                BOOST_TEST(h.starts_with(
+                    "HTTP/1.1 200 OK\r\n"));
+                BOOST_TEST(body == noise);
+            }
+
+            // text is compressed
+            {
+                auto const s = serialize(text, use_source);
+                core::string_view body;
+                auto const h = split(s, body);
+                BOOST_TEST_NE(
+                    h.find("Content-Encoding: gzip"),
+                    core::string_view::npos);
+                std::vector<unsigned char> compressed(
+                    body.begin(), body.end());
+                verify_compressed(compressed, text);
+            }
+        }
+
+        // the stream style waits for the sample
+        {
+            sr.reset();
+            response res;
+            res.set(field::content_encoding, "gzip");
+            res.set_chunked(true);
+            sr.use_gzip_encoding();
+            sr.skip_incompressible(4096);
+            auto st = sr.start_stream(res);
+
+            auto const commit = [&](std::size_t n)
+            {
+                auto n1 = buffers::buffer_copy(
+                    st.prepare(),
+                    buffers::const_buffer(
+                        noise.data(), n));
+                st.commit(n1);
+            };
+
+            commit(1000);
+            auto rv = sr.prepare();
+            BOOST_TEST(rv.has_error());
+            BOOST_TEST_EQ(rv.error(), error::need_data);
+
+            commit(4000);
+            st.close();
+            auto const s = read_all();
+            BOOST_TEST_EQ(
+                core::string_view(s).find(
+                    "Content-Encoding"),
+                core::string_view::npos);
+            BOOST_TEST(core::string_view(s).ends_with(
+                "\r\n0\r\n\r\n"));
+        }
+
+        // a body compressed up front
+        for(bool use_noise : { true, false })
+        {
+            core::string_view const b =
+                use_noise ? noise : text;
+            sr.reset();
+            response res;
+            res.set(field::content_encoding, "gzip");
+            sr.use_gzip_encoding();
+            sr.skip_incompressible();
+            sr.start_compressed(
+                res,
+                buffers::const_buffer(
+                    b.data(), b.size()));
+            auto const s = read_all();
+            core::string_view body;
+            auto const h = split(s, body);
+            if( use_noise )
+            {
+                BOOST_TEST_EQ(
+                    h.find("Content-Encoding"),
+                    core::string_view::npos);
+                BOOST_TEST_EQ(
+                    res.payload_size(), noise.size());
+                BOOST_TEST(body == noise);
+            }
+            else
+            {
+                BOOST_TEST_NE(
+                    h.find("Content-Encoding: gzip"),
+                    core::string_view::npos);
+                BOOST_TEST_EQ(
+                    res.payload_size(), body.size());
+                std::vector<unsigned char> compressed(
+                    body.begin(), body.end());
+                verify_compressed(compressed, text);
+            }
+        }
+    }
+
+    void
+    test_serializer_view()
+    {
+        std::string const text =
+            generate_book(50000);
+
+        struct view_source_t : view_source
+        {
+            core::string_view body_;
+            std::size_t n_ = 0;
+
+            explicit
+            view_source_t(core::string_view body)
+                : body_(body)
+            {
+            }
+
+            results
+            on_prepare() override
+            {
+                BOOST_TEST_EQ(n_, 0u);
+                results rs;
+                n_ = std::min(
+                    std::size_t{ 1000 },
+                    body_.size());
+                rs.data = { body_.data(), n_ };
+                rs.finished = n_ == body_.size();
+                return rs;
+            }
+
+            void
+            on_consume(std::size_t n) noexcept override
+            {
+                // the filter consumes
+                // the view as it goes
+                body_.remove_prefix(n);
+                n_ -= n;
+            }
+        };
+
+        context ctx;
+        zlib::install_service(ctx);
+        serializer sr(
+            ctx,
+            ctx.get_service<zlib::service>()
+                .deflator_space_needed(15, 8) + 65536);
+
+        for(bool chunked : { false, true })
+        {
+            sr.reset();
+            response res;
+            res.set(field::content_encoding, "gzip");
+            res.set_chunked(chunked);
+            sr.use_gzip_encoding();
+            auto& src =
+                sr.start_view<view_source_t>(res, text);
+
+            std::string out;
+            while(! sr.is_done() )
+            {
+                auto cbs = sr.prepare();
+                if(! BOOST_TEST(cbs.has_value()) )
+                    break;
+                auto const m =
+                    buffers::buffer_size(*cbs);
+                std::string s(m, 0);
+                buffers::buffer_copy(
+                    buffers::mutable_buffer(
+                        &s[0], s.size()), *cbs);
+                out += s;
+                sr.consume(m);
+            }
+            BOOST_TEST(src.body_.empty());
+
+            core::string_view sv = out;
+            if(chunked)
+            {
+                BOOST_TEST(sv.ends_with(
+                    "\r\n0\r\n\r\n"));
+                continue;
+            }
+            auto pos = sv.find("\r\n\r\n");
+            if(! BOOST_TEST_NE(
+                pos, core::string_view::npos))
+                continue;
+            sv.remove_prefix(pos + 4);
+            std::vector<unsigned char> compressed(
+                sv.begin(), sv.end());
+            verify_compressed(compressed, text);
+        }
+    }
+
+    void
+    test_serializer_async_source()
+    {
+        std::string const text =
+            generate_book(50000);
+        std::string noise(50000, 0);
+        {
+            std::mt19937 rng(1);
+            for(auto& c : noise)
+                c = static_cast<char>(rng());
+        }
+
+        // completes each operation with at
+        // most 1000 bytes when run_one is called
+        struct source_t : async_source
+        {
+            core::string_view body_;
+            buffers::mutable_buffer b_;
+            bool started_ = false;
+            bool sync_ = false;
+
+            source_t(
+                core::string_view body,
+                bool sync)
+                : body_(body)
+                , sync_(sync)
+            {
+            }
+
+            void
+            on_start(buffers::mutable_buffer b) override
+            {
+                b_ = b;
+                started_ = true;
+                if(sync_)
+                    run_one();
+            }
+
+            void
+            run_one()
+            {
+                started_ = false;
+                auto const n = (std::min)({
+                    body_.size(), b_.size(),
+                    std::size_t(1000) });
+                std::memcpy(b_.data(), body_.data(), n);
+                body_.remove_prefix(n);
+                complete(n, body_.empty());
+            }
+        };
+
+        context ctx;
+        zlib::install_service(ctx);
+        serializer sr(
+            ctx,
+            ctx.get_service<zlib::service>()
+                .deflator_space_needed(15, 8) + 65536);
+
+        auto const serialize = [&](
+            core::string_view body,
+            bool sync)
+        {
+            sr.reset();
+            response res;
+            res.set(field::content_encoding, "deflate");
+            sr.use_deflate_encoding();
+            sr.skip_incompressible();
+            auto& src = sr.start<source_t>(res, body, sync);
+
+            std::string out;
+            while(! sr.is_done() )
+            {
+                auto cbs = sr.prepare();
+                if( cbs.has_error() &&
+                    cbs.error() == error::would_block )
+                {
+                    // an operation is always in flight
+                    if(! BOOST_TEST(! sync) ||
+                        ! BOOST_TEST(src.is_pending()) )
+                        break;
+                    src.run_one();
+                    continue;
+                }
+                if(! BOOST_TEST(cbs.has_value()) )
+                    break;
+                auto const m =
+                    buffers::buffer_size(*cbs);
+                std::string s(m, 0);
+                buffers::buffer_copy(
+                    buffers::mutable_buffer(
+                        &s[0], s.size()), *cbs);
+                out += s;
+                sr.consume(m);
+            }
+            return out;
+        };
+
+        for(bool sync : { false, true })
+        {
+            // noise is sent as-is
+            {
+                auto const s = serialize(noise, sync);
+                auto const pos = s.find("\r\n\r\n");
+                if(! BOOST_TEST_NE(pos, std::string::npos))
+                    continue;
+                BOOST_TEST_EQ(
+                    s.substr(0, pos).find("Content-Encoding"),
+                    std::string::npos);
+                BOOST_TEST(s.substr(pos + 4) == noise);
+            }
+
+            // text is compressed
+            {
+                auto const s = serialize(text, sync);
+                auto const pos = s.find("\r\n\r\n");
+                if(! BOOST_TEST_NE(pos, std::string::npos))
+                    continue;
+                BOOST_TEST_NE(
+                    s.substr(0, pos).find(
+                        "Content-Encoding: deflate"),
+                    std::string::npos);
+                std::vector<unsigned char> compressed(
+                    s.begin() + pos + 4, s.end());
+                verify_compressed(compressed, text);
+            }
+        }
+    }
+
     void
     test_serializer_reports_zlib_errors()
     {
@@ -811,6 +1625,12 @@ struct zlib_test
     void run()
     {
         test_serializer();
+        test_serializer_known_length();
+        test_serializer_cache();
+        test_serializer_parallel();
+        test_serializer_skip_incompressible();
+        test_serializer_view();
+        test_serializer_async_source();
         test_serializer_reports_zlib_errors();
         test_parser();
         test_parser_reports_zlib_errors();